@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "ParseUtil.h"
+#include "SampleCards.h"
+#include "TextBlock.h"
 #include "TextRun.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -185,6 +187,18 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"MyAdditionalProperty\":\"Bar\"}\n"s, ParseUtil::JsonToString(value));
         }
 
+        TEST_METHOD(KnownPropertiesAreSharedBetweenCards)
+        {
+            std::shared_ptr<ParseResult> first = AdaptiveCard::DeserializeFromString("{\"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"unknown\": 1}", "1.0");
+            std::shared_ptr<ParseResult> second = AdaptiveCard::DeserializeFromString("{\"type\": \"AdaptiveCard\", \"version\": \"1.0\"}", "1.0");
+
+            const auto& knownProperties = first->GetAdaptiveCard()->GetKnownProperties();
+            Assert::IsTrue(&knownProperties == &second->GetAdaptiveCard()->GetKnownProperties());
+            Assert::IsTrue(knownProperties.count("body") == 1);
+            Assert::IsTrue(knownProperties.count("unknown") == 0);
+            Assert::AreEqual("{\"unknown\":1}\n"s, ParseUtil::JsonToString(first->GetAdaptiveCard()->GetAdditionalProperties()));
+        }
+
         TEST_METHOD(UnknownElementRoundtripping)
         {
             std::string testJsonString =
@@ -209,5 +223,75 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"actions\":[],\"body\":[{\"text\":\"Standard textblock\",\"type\":\"TextBlock\"},{\"property\":\"value\",\"someOtherProperty\":\"some other value\",\"type\":\"SomeRandomType\"}],\"type\":\"AdaptiveCard\",\"version\":\"1.0\"}\n"s,
                 outputCard);
         }
+
+        TEST_METHOD(AdditionalPropertiesMatchEagerCaptureOnSamples)
+        {
+            // DeserializeFromString keeps references into its document; Deserialize on a caller's JSON copies
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                const std::string cardJson = ReadSampleCard(samplePath);
+                // Labels found through "labelFor" are remembered between parses, so the first parse of a card can
+                // come out differently from later ones
+                DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(cardJson, "1.6"); });
+                const std::string expected = DescribeParse([&]() {
+                    ParseContext context;
+                    return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(cardJson), "1.6", context);
+                });
+                const std::string actual = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(cardJson, "1.6"); });
+                Assert::AreEqual(expected, actual, samplePath.wstring().c_str());
+            }
+        }
+
+        TEST_METHOD(AdditionalPropertiesOutliveSourceJson)
+        {
+            std::shared_ptr<TextBlock> copy;
+            std::shared_ptr<ParseResult> parseResult;
+            {
+                const std::string testJsonString = R"({"type": "AdaptiveCard", "version": "1.0", "body": [
+                    {"type": "TextBlock", "text": "Hello", "unknown": {"nested": [1, 2, 3]}}]})";
+                parseResult = AdaptiveCard::DeserializeFromString(testJsonString, "1.0");
+                copy = std::make_shared<TextBlock>(*std::static_pointer_cast<TextBlock>(parseResult->GetAdaptiveCard()->GetBody().front()));
+            }
+
+            const auto textBlock = parseResult->GetAdaptiveCard()->GetBody().front();
+            Assert::IsTrue(textBlock->Serialize().find("\"unknown\":{\"nested\":[1,2,3]}") != std::string::npos);
+            Assert::AreEqual("{\"unknown\":{\"nested\":[1,2,3]}}\n"s, ParseUtil::JsonToString(textBlock->GetAdditionalProperties()));
+            Assert::AreEqual("{\"unknown\":{\"nested\":[1,2,3]}}\n"s, ParseUtil::JsonToString(copy->GetAdditionalProperties()));
+
+            copy->SetAdditionalProperties(Json::Value());
+            Assert::IsTrue(copy->GetAdditionalProperties().isNull());
+            Assert::AreEqual("{\"unknown\":{\"nested\":[1,2,3]}}\n"s, ParseUtil::JsonToString(textBlock->GetAdditionalProperties()));
+        }
+
+        TEST_METHOD(CustomParserJsonIsNotReferenced)
+        {
+            // A custom parser that hands JSON of its own to a built-in parser
+            class GreetingParser : public BaseCardElementParser
+            {
+            public:
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& value) override
+                {
+                    Json::Value textBlockJson;
+                    textBlockJson["type"] = "TextBlock";
+                    textBlockJson["text"] = "Hello " + value["name"].asString();
+                    textBlockJson["greeting"] = true;
+                    return TextBlockParser().Deserialize(context, textBlockJson);
+                }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+                {
+                    return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+                }
+            };
+
+            const auto elementRegistration = std::make_shared<ElementParserRegistration>();
+            elementRegistration->AddParser("Greeting", std::make_shared<GreetingParser>());
+            ParseContext context(elementRegistration, nullptr);
+            const auto parseResult = AdaptiveCard::DeserializeFromString(
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "Greeting", "name": "world"}]})", "1.0", context);
+
+            const auto textBlock = parseResult->GetAdaptiveCard()->GetBody().front();
+            Assert::AreEqual("{\"greeting\":true}\n"s, ParseUtil::JsonToString(textBlock->GetAdditionalProperties()));
+            Assert::IsTrue(context.GetSourceDocument() == nullptr);
+        }
     };
 }
@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "BatchDeserializer.h"
+#include "SampleCards.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string s_DescribeResult(const BatchDeserializer::Result& result)
+    {
+        Assert::IsTrue((result.parseResult == nullptr) != (result.error == nullptr));
+        return DescribeParse([&]() {
+            if (result.error)
+            {
+                throw *result.error;
+            }
+            return result.parseResult;
+        });
+    }
+
+    // Describes a serial parse the way s_DescribeResult describes a batch result
+    static std::string s_DescribeSerialParse(const std::string& json)
+    {
+        const std::string description = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+
+        const std::string otherException = "exception: ";
+        if (description.compare(0, otherException.size(), otherException) == 0)
+        {
+            return "error " + std::to_string(static_cast<int>(ErrorStatusCode::CustomError)) + ": " +
+                   description.substr(otherException.size());
+        }
+        return description;
+    }
+
+    TEST_CLASS(BatchDeserializerTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchSerialParse)
+        {
+            std::vector<std::string> cards;
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                cards.push_back(ReadSampleCard(samplePath));
+            }
+
+            // Labels declared with "labelFor" are remembered across parses, so parse everything once up front to
+            // make sure all of the parses below see the same label state.
+            std::vector<std::string> expected;
+            for (const auto& card : cards)
+            {
+                s_DescribeSerialParse(card);
+            }
+            for (const auto& card : cards)
+            {
+                expected.push_back(s_DescribeSerialParse(card));
+            }
+
+            for (unsigned int threadCount : {1, 2, 4, 8})
+            {
+                const BatchDeserializer batchDeserializer(std::make_shared<ParseThreadPool>(threadCount));
+                const auto results = batchDeserializer.DeserializeFromStrings(cards, "1.6");
+
+                Assert::AreEqual(cards.size(), results.size());
+                for (size_t i = 0; i < cards.size(); ++i)
+                {
+                    Assert::AreEqual(expected[i], s_DescribeResult(results[i]));
+                }
+            }
+        }
+
+        TEST_METHOD(ErrorsStayWithTheirCard)
+        {
+            const std::vector<std::string> cards{
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "First"}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [)",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "id": "a", "text": "A"},
+                    {"type": "TextBlock", "id": "a", "text": "B"}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": ""}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "id": "a", "text": "Last"}]})"};
+
+            const BatchDeserializer batchDeserializer(std::make_shared<ParseThreadPool>(4));
+            const auto results = batchDeserializer.DeserializeFromStrings(cards, "1.6");
+
+            Assert::AreEqual(cards.size(), results.size());
+            for (size_t i = 0; i < cards.size(); ++i)
+            {
+                Assert::AreEqual(s_DescribeSerialParse(cards[i]), s_DescribeResult(results[i]));
+            }
+
+            Assert::AreEqual(static_cast<int>(ErrorStatusCode::InvalidJson), static_cast<int>(results[1].error->GetStatusCode()));
+            Assert::AreEqual(static_cast<int>(ErrorStatusCode::IdCollision), static_cast<int>(results[2].error->GetStatusCode()));
+            Assert::AreEqual(static_cast<size_t>(1), results[3].parseResult->GetWarnings().size());
+
+            // IDs are only checked within a card
+            Assert::IsTrue(results[4].parseResult != nullptr);
+        }
+
+        TEST_METHOD(BuffersNeedNotBeNullTerminated)
+        {
+            const std::string cards = R"({"type": "AdaptiveCard", "version": "1.0"}{"type": "AdaptiveCard", "version": "1.2"})";
+            const size_t split = cards.find("}{") + 1;
+            const BatchDeserializer::JsonBuffer buffers[] = {{cards.data(), split}, {cards.data() + split, cards.size() - split}};
+
+            const BatchDeserializer batchDeserializer(std::make_shared<ParseThreadPool>(2));
+            const auto results = batchDeserializer.DeserializeFromBuffers(buffers, 2, "1.6");
+
+            Assert::AreEqual(std::string("1.0"), results[0].parseResult->GetAdaptiveCard()->GetVersion());
+            Assert::AreEqual(std::string("1.2"), results[1].parseResult->GetAdaptiveCard()->GetVersion());
+            Assert::IsTrue(batchDeserializer.DeserializeFromBuffers(nullptr, 0, "1.6").empty());
+        }
+    };
+}
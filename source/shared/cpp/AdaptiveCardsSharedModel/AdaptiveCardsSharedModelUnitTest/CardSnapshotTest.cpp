@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardSnapshot.h"
+#include "ParseUtil.h"
+#include "SampleCards.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static void s_VerifySnapshotThrows(const std::string& snapshot)
+    {
+        try
+        {
+            CardSnapshot::Read(snapshot.data(), snapshot.size());
+            Assert::Fail(L"Expected an exception for an invalid snapshot");
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            Assert::AreEqual(static_cast<int>(ErrorStatusCode::InvalidJson), static_cast<int>(e.GetStatusCode()));
+        }
+    }
+
+    TEST_CLASS(CardSnapshotTest)
+    {
+    public:
+        TEST_METHOD(SamplesRoundTrip)
+        {
+            const auto samplePaths = GetSampleCardPaths();
+            Assert::IsFalse(samplePaths.empty());
+
+            for (const auto& samplePath : samplePaths)
+            {
+                const std::string json = ReadSampleCard(samplePath);
+                std::shared_ptr<ParseResult> parseResult;
+                try
+                {
+                    parseResult = AdaptiveCard::DeserializeFromString(json, "1.6");
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // Samples that don't parse have nothing to snapshot
+                    continue;
+                }
+
+                Logger::WriteMessage(("Verifying " + samplePath.string() + "\n").c_str());
+                const auto card = parseResult->GetAdaptiveCard();
+                const std::string snapshot = card->SerializeToSnapshot();
+
+                // The snapshot must hold exactly what the card serializes to, including the type of every number
+                const Json::Value cardJson = card->SerializeToJsonValue();
+                const Json::Value snapshotJson = CardSnapshot::Read(snapshot.data(), snapshot.size());
+                Assert::IsTrue(cardJson == snapshotJson);
+                Assert::AreEqual(ParseUtil::JsonToString(cardJson), ParseUtil::JsonToString(snapshotJson));
+
+                // and loading it must give the same card as loading the serialized JSON
+                const std::string serialized = card->Serialize();
+                Assert::AreEqual(DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(serialized, "1.6"); }),
+                                 DescribeParse([&]() { return AdaptiveCard::DeserializeFromSnapshot(snapshot.data(), snapshot.size(), "1.6"); }));
+            }
+        }
+
+        TEST_METHOD(ValuesRoundTrip)
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(R"({
+                "type": "AdaptiveCard",
+                "nothing": null,
+                "flags": [true, false],
+                "ints": [0, -1, 1, -2147483648, 2147483647, -9223372036854775808, 9223372036854775807],
+                "uint": 18446744073709551615,
+                "doubles": [0.5, -1e-300, 1.7976931348623157e308],
+                "strings": ["", "type", "😀 \"quoted\"\n", "embedded\u0000null"],
+                "nested": [[], {}, [{"type": "type"}]]
+            })");
+
+            const std::string snapshot = CardSnapshot::Write(json);
+            const Json::Value roundTripped = CardSnapshot::Read(snapshot.data(), snapshot.size());
+            Assert::IsTrue(json == roundTripped);
+            Assert::AreEqual(ParseUtil::JsonToString(json), ParseUtil::JsonToString(roundTripped));
+            Assert::IsTrue(roundTripped["uint"].isUInt64());
+            Assert::IsFalse(roundTripped["uint"].isInt64());
+        }
+
+        TEST_METHOD(InvalidSnapshotsThrow)
+        {
+            const std::string snapshot = CardSnapshot::Write(ParseUtil::GetJsonValueFromString(
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "hi"}]})"));
+
+            s_VerifySnapshotThrows("");
+            s_VerifySnapshotThrows(R"({"type": "AdaptiveCard"})");
+
+            // a snapshot from another format version
+            std::string otherVersion = snapshot;
+            otherVersion[4] = static_cast<char>(otherVersion[4] + 1);
+            s_VerifySnapshotThrows(otherVersion);
+
+            // every truncation, and trailing data
+            for (size_t length = 0; length < snapshot.size(); ++length)
+            {
+                s_VerifySnapshotThrows(snapshot.substr(0, length));
+            }
+            s_VerifySnapshotThrows(snapshot + '\0');
+        }
+    };
+}
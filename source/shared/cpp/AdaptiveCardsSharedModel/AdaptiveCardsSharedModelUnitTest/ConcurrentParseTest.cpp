@@ -0,0 +1,240 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "SampleCards.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+#include "UnknownElement.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+// These tests parse cards on many threads at once. On their own they only check results; build with
+// -fsanitize=thread (or /fsanitize=thread) and run them to have ThreadSanitizer check for data races as well.
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    constexpr unsigned int c_stressThreadCount = 8;
+
+    static void s_RunOnThreads(unsigned int threadCount, const std::function<void(unsigned int)>& work)
+    {
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(work, i);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    static void s_CollectInternalIds(const std::vector<std::shared_ptr<BaseCardElement>>& elements, std::vector<unsigned int>& internalIds)
+    {
+        for (const auto& element : elements)
+        {
+            internalIds.push_back(element->GetInternalId().Hash());
+        }
+    }
+
+    class CustomTextParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(ParseContext&, const Json::Value&) override
+        {
+            auto textBlock = std::make_shared<TextBlock>();
+            textBlock->SetText("custom");
+            return textBlock;
+        }
+
+        std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+        {
+            return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        }
+    };
+
+    TEST_CLASS(ConcurrentParseTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchSerialParse)
+        {
+            std::vector<std::string> cards;
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                cards.push_back(ReadSampleCard(samplePath));
+            }
+
+            // Labels declared with "labelFor" are remembered across parses, so parse everything once up front to
+            // make sure all of the parses below see the same label state.
+            std::vector<std::string> expected;
+            for (const auto& card : cards)
+            {
+                DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(card, "1.6"); });
+            }
+            for (const auto& card : cards)
+            {
+                expected.push_back(DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(card, "1.6"); }));
+            }
+
+            // Every thread parses every card, starting at a different point so that different cards overlap, and
+            // some threads also split large collections over a pool of their own
+            std::vector<std::vector<std::string>> actual(c_stressThreadCount);
+            s_RunOnThreads(c_stressThreadCount, [&](unsigned int thread) {
+                const auto threadPool = (thread % 2) ? std::make_shared<ParseThreadPool>(3) : nullptr;
+                actual[thread].resize(cards.size());
+                for (size_t n = 0; n < cards.size(); ++n)
+                {
+                    const size_t i = (n + thread * cards.size() / c_stressThreadCount) % cards.size();
+                    actual[thread][i] = DescribeParse([&]() {
+                        ParseContext context;
+                        context.SetParseThreadPool(threadPool);
+                        return AdaptiveCard::DeserializeFromString(cards[i], "1.6", context);
+                    });
+                }
+            });
+
+            for (const auto& threadResults : actual)
+            {
+                for (size_t i = 0; i < cards.size(); ++i)
+                {
+                    Assert::AreEqual(expected[i], threadResults[i]);
+                }
+            }
+        }
+
+        TEST_METHOD(InternalIdsAreUniqueAcrossThreads)
+        {
+            const std::string card = R"({"type": "AdaptiveCard", "version": "1.5", "body": [
+                {"type": "TextBlock", "text": "One"},
+                {"type": "Container", "items": [{"type": "TextBlock", "text": "Two"}]},
+                {"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png"}]})";
+
+            std::vector<std::vector<unsigned int>> internalIds(c_stressThreadCount);
+            s_RunOnThreads(c_stressThreadCount, [&](unsigned int thread) {
+                for (unsigned int i = 0; i < 500; ++i)
+                {
+                    auto parsedCard = AdaptiveCard::DeserializeFromString(card, "1.6")->GetAdaptiveCard();
+                    internalIds[thread].push_back(parsedCard->GetInternalId().Hash());
+                    s_CollectInternalIds(parsedCard->GetBody(), internalIds[thread]);
+                }
+            });
+
+            std::unordered_set<unsigned int> seen;
+            for (const auto& threadIds : internalIds)
+            {
+                for (unsigned int internalId : threadIds)
+                {
+                    Assert::AreNotEqual(static_cast<unsigned int>(InternalId::Invalid), internalId);
+                    Assert::IsTrue(seen.insert(internalId).second);
+                }
+            }
+        }
+
+        TEST_METHOD(IdCollisionsAreDetectedOnEveryThread)
+        {
+            const std::string collision = R"({"type": "AdaptiveCard", "version": "1.5", "body": [
+                {"type": "TextBlock", "id": "duplicate", "text": "One"},
+                {"type": "Container", "items": [{"type": "TextBlock", "id": "duplicate", "text": "Two"}]}]})";
+            const std::string fallback = R"({"type": "AdaptiveCard", "version": "1.5", "body": [
+                {"type": "Unknown", "id": "duplicate", "fallback": {"type": "TextBlock", "id": "duplicate", "text": "Fallback"}}]})";
+
+            std::vector<unsigned int> collisions(c_stressThreadCount);
+            std::vector<unsigned int> successes(c_stressThreadCount);
+            s_RunOnThreads(c_stressThreadCount, [&](unsigned int thread) {
+                for (unsigned int i = 0; i < 200; ++i)
+                {
+                    try
+                    {
+                        AdaptiveCard::DeserializeFromString(collision, "1.6");
+                    }
+                    catch (const AdaptiveCardParseException& e)
+                    {
+                        if (e.GetStatusCode() == ErrorStatusCode::IdCollision)
+                        {
+                            ++collisions[thread];
+                        }
+                    }
+
+                    // Fallback content may still reuse the id of the element it replaces
+                    if (AdaptiveCard::DeserializeFromString(fallback, "1.6")->GetAdaptiveCard()->GetBody().size() == 1)
+                    {
+                        ++successes[thread];
+                    }
+                }
+            });
+
+            for (unsigned int thread = 0; thread < c_stressThreadCount; ++thread)
+            {
+                Assert::AreEqual(200u, collisions[thread]);
+                Assert::AreEqual(200u, successes[thread]);
+            }
+        }
+
+        TEST_METHOD(DeferredShowCardsAreParsedOnce)
+        {
+            ParseContext context;
+            context.SetDeferShowCardParsing(true);
+            const auto parseResult = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard", "version": "1.5", "actions": [{"type": "Action.ShowCard", "title": "More",
+                    "card": {"type": "AdaptiveCard", "body": [{"type": "Input.Text", "id": "name"}]}}]})",
+                                                                         "1.6",
+                                                                         context);
+            const auto action = std::static_pointer_cast<ShowCardAction>(parseResult->GetAdaptiveCard()->GetActions().at(0));
+
+            std::mutex cardsMutex;
+            std::vector<std::shared_ptr<AdaptiveCard>> cards;
+            s_RunOnThreads(c_stressThreadCount, [&](unsigned int) {
+                auto card = action->GetCard();
+                std::lock_guard<std::mutex> lock(cardsMutex);
+                cards.push_back(card);
+            });
+
+            for (const auto& card : cards)
+            {
+                Assert::IsTrue(card == cards.front());
+            }
+        }
+
+        TEST_METHOD(CustomParsersCanChangeWhileParsing)
+        {
+            const std::string card = R"({"type": "AdaptiveCard", "version": "1.5", "body": [
+                {"type": "Custom.Text", "id": "custom"}, {"type": "TextBlock", "text": "Built in"}]})";
+            const auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            const auto customParser = std::make_shared<CustomTextParser>();
+
+            std::atomic<bool> parsing{true};
+            std::vector<unsigned int> customCounts(c_stressThreadCount);
+            std::thread registrar([&]() {
+                while (parsing)
+                {
+                    elementParserRegistration->AddParser("Custom.Text", customParser);
+                    elementParserRegistration->RemoveParser("Custom.Text");
+                }
+            });
+            s_RunOnThreads(c_stressThreadCount, [&](unsigned int thread) {
+                for (unsigned int i = 0; i < 200; ++i)
+                {
+                    ParseContext context(elementParserRegistration, nullptr);
+                    const auto body = AdaptiveCard::DeserializeFromString(card, "1.6", context)->GetAdaptiveCard()->GetBody();
+                    Assert::AreEqual(static_cast<size_t>(2), body.size());
+                    if (const auto textBlock = std::dynamic_pointer_cast<TextBlock>(body[0]))
+                    {
+                        Assert::AreEqual(std::string("custom"), textBlock->GetText());
+                        ++customCounts[thread];
+                    }
+                    else
+                    {
+                        Assert::IsTrue(std::dynamic_pointer_cast<UnknownElement>(body[0]) != nullptr);
+                    }
+                    Assert::AreEqual(std::string("Built in"), std::static_pointer_cast<TextBlock>(body[1])->GetText());
+                }
+            });
+            parsing = false;
+            registrar.join();
+        }
+    };
+}
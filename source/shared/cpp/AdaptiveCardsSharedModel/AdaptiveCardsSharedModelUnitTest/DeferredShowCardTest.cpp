@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "SampleCards.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::shared_ptr<ParseResult> s_ParseDeferred(const std::string& json, const std::string& rendererVersion = "1.6")
+    {
+        ParseContext context;
+        context.SetDeferShowCardParsing(true);
+        return AdaptiveCard::DeserializeFromString(json, rendererVersion, context);
+    }
+
+    static std::shared_ptr<ShowCardAction> s_GetShowCardAction(const std::shared_ptr<ParseResult>& parseResult, size_t index = 0)
+    {
+        auto action = parseResult->GetAdaptiveCard()->GetActions().at(index);
+        Assert::IsTrue(action->GetElementType() == ActionType::ShowCard);
+        return std::static_pointer_cast<ShowCardAction>(action);
+    }
+
+    static std::string s_DescribeResources(const std::vector<RemoteResourceInformation>& resources)
+    {
+        std::string description;
+        for (const auto& resource : resources)
+        {
+            description.append(resource.url).append(" ").append(resource.mimeType).append("\n");
+        }
+        return description;
+    }
+
+    TEST_CLASS(DeferredShowCardTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchEagerParse)
+        {
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                Logger::WriteMessage(("Verifying " + samplePath.string() + "\n").c_str());
+                const std::string json = ReadSampleCard(samplePath);
+
+                // Labels declared with "labelFor" are remembered across parses, so parse once up front to make sure
+                // all of the parses below see the same label state.
+                DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+
+                std::shared_ptr<ParseResult> eager;
+                try
+                {
+                    eager = AdaptiveCard::DeserializeFromString(json, "1.6");
+                }
+                catch (const std::exception&)
+                {
+                    continue;
+                }
+
+                auto deferred = s_ParseDeferred(json);
+
+                // Resources come out the same without parsing the deferred cards
+                Assert::AreEqual(s_DescribeResources(eager->GetAdaptiveCard()->GetResourceInformation()),
+                                 s_DescribeResources(deferred->GetAdaptiveCard()->GetResourceInformation()));
+                for (const auto& action : deferred->GetAdaptiveCard()->GetActions())
+                {
+                    if (action->GetElementType() == ActionType::ShowCard)
+                    {
+                        Assert::IsTrue(std::static_pointer_cast<ShowCardAction>(action)->IsCardDeferred());
+                    }
+                }
+
+                // Serializing parses them
+                Assert::AreEqual(eager->GetAdaptiveCard()->Serialize(), deferred->GetAdaptiveCard()->Serialize());
+            }
+        }
+
+        TEST_METHOD(CardIsParsedOnFirstGetCard)
+        {
+            const auto parseResult = s_ParseDeferred(R"({
+                "type": "AdaptiveCard", "version": "1.2", "lang": "fr",
+                "actions": [{"type": "Action.ShowCard", "title": "More", "card": {
+                    "type": "AdaptiveCard", "body": [{"type": "TextBlock", "text": "Hidden"}]}}]})");
+
+            const auto action = s_GetShowCardAction(parseResult);
+            const ShowCardAction copy(*action);
+            Assert::IsTrue(action->IsCardDeferred());
+
+            const auto card = action->GetCard();
+            Assert::IsFalse(action->IsCardDeferred());
+            Assert::IsTrue(card == action->GetCard());
+            Assert::IsTrue(card == copy.GetCard());
+
+            // The card picks up the version and language of the card around it, as it does in an eager parse
+            Assert::AreEqual(std::string("1.2"), card->GetVersion());
+            Assert::AreEqual(std::string("fr"), card->GetLanguage());
+
+            const auto textBlock = std::static_pointer_cast<TextBlock>(card->GetBody().at(0));
+            Assert::AreEqual(std::string("Hidden"), textBlock->GetText());
+            Assert::AreEqual(std::string("fr"), textBlock->GetLanguage());
+
+            // Setting a card replaces the deferred one
+            action->SetCard(std::make_shared<AdaptiveCard>());
+            Assert::IsFalse(action->IsCardDeferred());
+            Assert::IsTrue(card != action->GetCard());
+        }
+
+        TEST_METHOD(IdCollisionsAreDetected)
+        {
+            // Collides with an element that comes after the action, so the eager parse only sees it at the end
+            const std::string collision = R"({
+                "type": "AdaptiveCard", "version": "1.2",
+                "actions": [
+                    {"type": "Action.ShowCard", "title": "More", "card": {
+                        "type": "AdaptiveCard", "body": [{"type": "Input.Text", "id": "name"}]}},
+                    {"type": "Action.Submit", "id": "name"}]})";
+
+            Assert::AreEqual(std::string("error 5: Collision detected for id 'name'"),
+                             DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(collision, "1.6"); }));
+
+            const auto parseResult = s_ParseDeferred(collision);
+            try
+            {
+                s_GetShowCardAction(parseResult)->GetCard();
+                Assert::Fail(L"Expected an ID collision");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::AreEqual(static_cast<int>(ErrorStatusCode::IdCollision), static_cast<int>(e.GetStatusCode()));
+            }
+
+            // IDs of two deferred cards are checked against each other, and fallback may still reuse its parent's ID
+            const std::string twoCards = R"({
+                "type": "AdaptiveCard", "version": "1.2",
+                "actions": [
+                    {"type": "Action.ShowCard", "title": "One", "card": {
+                        "type": "AdaptiveCard", "body": [{"type": "Input.Text", "id": "name",
+                            "fallback": {"type": "Input.Text", "id": "name"}}]}},
+                    {"type": "Action.ShowCard", "title": "Two", "card": {
+                        "type": "AdaptiveCard", "body": [{"type": "Input.Text", "id": "name"}]}}]})";
+
+            const auto twoCardsResult = s_ParseDeferred(twoCards);
+            s_GetShowCardAction(twoCardsResult, 0)->GetCard();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { s_GetShowCardAction(twoCardsResult, 1)->GetCard(); });
+
+            // Enumerating resources doesn't record the card's IDs
+            const auto resourcesFirst = s_ParseDeferred(twoCards);
+            resourcesFirst->GetAdaptiveCard()->GetResourceInformation();
+            s_GetShowCardAction(resourcesFirst, 0)->GetCard();
+        }
+
+        TEST_METHOD(ErrorsInTheCardTypeAreNotDeferred)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() {
+                s_ParseDeferred(R"({"type": "AdaptiveCard", "version": "1.2",
+                    "actions": [{"type": "Action.ShowCard", "title": "More", "card": {"type": "Container", "items": []}}]})");
+            });
+        }
+
+        TEST_METHOD(WarningsAreReportedWithTheCard)
+        {
+            const std::string json = R"({
+                "type": "AdaptiveCard", "version": "1.2",
+                "actions": [{"type": "Action.ShowCard", "title": "More", "card": {
+                    "type": "AdaptiveCard", "body": [{"type": "TextBlock", "text": ""}]}}]})";
+
+            const auto eager = AdaptiveCard::DeserializeFromString(json, "1.6");
+            Assert::IsFalse(eager->GetWarnings().empty());
+            Assert::IsTrue(s_GetShowCardAction(eager)->GetCardWarnings().empty());
+
+            const auto deferred = s_ParseDeferred(json);
+            Assert::IsTrue(deferred->GetWarnings().empty());
+
+            const auto warnings = s_GetShowCardAction(deferred)->GetCardWarnings();
+            Assert::AreEqual(static_cast<size_t>(1), warnings.size());
+            Assert::AreEqual(static_cast<int>(eager->GetWarnings().back()->GetStatusCode()),
+                             static_cast<int>(warnings.at(0)->GetStatusCode()));
+            Assert::AreEqual(eager->GetWarnings().back()->GetReason(), warnings.at(0)->GetReason());
+        }
+
+        TEST_METHOD(ResourceInformationDoesNotParseTheCard)
+        {
+            const auto parseResult = s_ParseDeferred(R"({
+                "type": "AdaptiveCard", "version": "1.2",
+                "actions": [{"type": "Action.ShowCard", "title": "More", "card": {
+                    "type": "AdaptiveCard", "body": [{"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png"}]}}]})");
+
+            const auto resources = parseResult->GetAdaptiveCard()->GetResourceInformation();
+            Assert::AreEqual(std::string("https://adaptivecards.io/content/cats/1.png image\n"), s_DescribeResources(resources));
+            Assert::IsTrue(s_GetShowCardAction(parseResult)->IsCardDeferred());
+        }
+    };
+}
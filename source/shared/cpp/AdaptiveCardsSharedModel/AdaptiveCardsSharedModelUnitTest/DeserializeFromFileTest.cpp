@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "MappedFile.h"
+#include "SampleCards.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::filesystem::path s_WriteTemporaryCard(const std::string& name, const std::string& contents)
+    {
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << contents;
+        return path;
+    }
+
+    TEST_CLASS(DeserializeFromFileTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchDeserializeFromString)
+        {
+            const auto samplePaths = GetSampleCardPaths();
+            Assert::IsFalse(samplePaths.empty());
+
+            for (const auto& samplePath : samplePaths)
+            {
+                Logger::WriteMessage(("Verifying " + samplePath.string() + "\n").c_str());
+                const std::string json = ReadSampleCard(samplePath);
+
+                // Labels declared with "labelFor" are remembered across parses, so parse once up front to make sure
+                // all of the parses below see the same label state.
+                DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+                const std::string expected = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+
+                Assert::AreEqual(expected, DescribeParse([&]() { return AdaptiveCard::DeserializeFromFile(samplePath.string(), "1.6"); }));
+
+                // The buffer overload must not read past length, so give it a buffer followed by unrelated bytes
+                const std::string padded = json + "}}}";
+                Assert::AreEqual(expected, DescribeParse([&]() { return AdaptiveCard::DeserializeFromBuffer(padded.data(), json.size(), "1.6"); }));
+            }
+        }
+
+        TEST_METHOD(MappedFileReadsWholeFile)
+        {
+            // Large enough to span several pages
+            std::string contents;
+            for (unsigned int i = 0; contents.size() < 64 * 1024; ++i)
+            {
+                contents.append(std::to_string(i)).append(" ");
+            }
+
+            const auto path = s_WriteTemporaryCard("MappedFileReadsWholeFile.json", contents);
+            {
+                const MappedFile file(path.string());
+                Assert::AreEqual(contents, std::string(file.GetData(), file.GetSize()));
+            }
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(EmptyAndMissingFiles)
+        {
+            const auto emptyPath = s_WriteTemporaryCard("EmptyAndMissingFiles.json", "");
+            {
+                const MappedFile file(emptyPath.string());
+                Assert::AreEqual(static_cast<size_t>(0), file.GetSize());
+            }
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromFile(emptyPath.string(), "1.6"); });
+            std::filesystem::remove(emptyPath);
+
+            const auto missingPath = std::filesystem::temp_directory_path() / "EmptyAndMissingFiles.missing.json";
+            try
+            {
+                AdaptiveCard::DeserializeFromFile(missingPath.string(), "1.6");
+                Assert::Fail(L"Expected an exception for a missing file");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::AreEqual(static_cast<int>(ErrorStatusCode::InvalidJson), static_cast<int>(e.GetStatusCode()));
+                Assert::AreEqual("Unable to read file: " + missingPath.string(), e.GetReason());
+            }
+        }
+
+        TEST_METHOD(MalformedBufferThrows)
+        {
+            const std::string json = R"({"type": "AdaptiveCard", "version": "1.0", "body": [)";
+            try
+            {
+                AdaptiveCard::DeserializeFromBuffer(json.data(), json.size(), "1.6");
+                Assert::Fail(L"Expected an exception for malformed JSON");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::AreEqual(static_cast<int>(ErrorStatusCode::InvalidJson), static_cast<int>(e.GetStatusCode()));
+            }
+        }
+    };
+}
@@ -58,5 +58,31 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(SchemaKeysRoundTripIgnoringCase)
+        {
+            // A few keys share a name (such as "type"), so compare names rather than keys
+            for (const auto key : EnumHelpers::getAdaptiveCardSchemaKeyEnum().values())
+            {
+                const std::string name = AdaptiveCardSchemaKeyToString(key);
+                Assert::AreEqual(name, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKeyFromString(name)));
+
+                std::string upperName = name;
+                std::transform(upperName.begin(), upperName.end(), upperName.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+                Assert::AreEqual(name, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKeyFromString(upperName)));
+            }
+
+            // Anagrams of a key must not match it
+            Assert::ExpectException<std::out_of_range>([]() { AdaptiveCardSchemaKeyFromString("tnecca"); });
+            Assert::ExpectException<std::out_of_range>([]() { AdaptiveCardSchemaKeyFromString(""); });
+        }
+
+        TEST_METHOD(AliasesOnlyMapFromString)
+        {
+            Assert::IsTrue(ImageStyleFromString("NORMAL") == ImageStyle::Default);
+            Assert::AreEqual("default"s, ImageStyleToString(ImageStyle::Default));
+            Assert::IsTrue(TextWeightFromString("normal") == TextWeight::Default);
+            Assert::AreEqual("Default"s, TextWeightToString(TextWeight::Default));
+        }
     };
 }
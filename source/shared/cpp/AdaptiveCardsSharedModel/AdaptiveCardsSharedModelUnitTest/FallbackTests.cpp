@@ -597,6 +597,24 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(textBlockNoRequires->MeetsRequirements(featureRegistration));
         }
 
+        TEST_METHOD(RequiresAnyVersionOfFeature)
+        {
+            TextBlock textBlock;
+            textBlock.GetRequirements().emplace("foobar", SemanticVersion("2"));
+
+            // "*" provides every version of a feature, and names match regardless of case
+            FeatureRegistration featureRegistration;
+            featureRegistration.AddFeature("FooBar", "*");
+            Assert::IsTrue(textBlock.MeetsRequirements(featureRegistration));
+            Assert::AreEqual("*"s, featureRegistration.GetFeatureVersion("foobar"));
+
+            textBlock.GetRequirements().emplace("adaptiveCards", SemanticVersion("99"));
+            Assert::IsFalse(textBlock.MeetsRequirements(featureRegistration));
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.AddFeature("other", "1.x"); });
+            Assert::IsTrue(featureRegistration.GetFeatureVersion("other").empty());
+        }
+
         TEST_METHOD(NestedFallbacksSerialization)
         {
             std::string cardStr = R"card({
@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "JsonWriter.h"
+#include "ParseUtil.h"
+#include "SampleCards.h"
+#include <limits>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // What ParseUtil::JsonToString used to do
+    static std::string s_WriteWithStreamWriter(const Json::Value& json)
+    {
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+        std::ostringstream outStream;
+        writer->write(json, &outStream);
+        outStream << std::endl;
+        return outStream.str();
+    }
+
+    static void s_VerifyMatchesStreamWriter(const Json::Value& json)
+    {
+        Assert::AreEqual(s_WriteWithStreamWriter(json), ParseUtil::JsonToString(json));
+    }
+
+    TEST_CLASS(JsonWriterTest)
+    {
+    public:
+        TEST_METHOD(ScalarsMatchStreamWriter)
+        {
+            s_VerifyMatchesStreamWriter(Json::Value());
+            s_VerifyMatchesStreamWriter(Json::Value(true));
+            s_VerifyMatchesStreamWriter(Json::Value(false));
+            s_VerifyMatchesStreamWriter(Json::Value(0));
+            s_VerifyMatchesStreamWriter(Json::Value(std::numeric_limits<Json::Int64>::min()));
+            s_VerifyMatchesStreamWriter(Json::Value(std::numeric_limits<Json::Int64>::max()));
+            s_VerifyMatchesStreamWriter(Json::Value(std::numeric_limits<Json::UInt64>::max()));
+            for (double value : {0.0, -0.0, 1.0, -2.5, 0.1, 1e21, 1.5e-7, 123456789012345678.0,
+                                 std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                 std::numeric_limits<double>::quiet_NaN()})
+            {
+                s_VerifyMatchesStreamWriter(Json::Value(value));
+            }
+        }
+
+        TEST_METHOD(StringsMatchStreamWriter)
+        {
+            for (const std::string value : {std::string(""), std::string("plain text"), std::string("quote \" and \\ backslash / slash"),
+                                            std::string("\b\f\n\r\t\x01\x1f\x7f"), std::string("nul \0 inside", 12),
+                                            std::string("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80"),
+                                            // Truncated, overlong and surrogate sequences, and stray continuation bytes
+                                            std::string("\xc3"), std::string("\xe2\x82"), std::string("\xc0\xaf"),
+                                            std::string("\xed\xa0\x80"), std::string("\x80\xbf x"), std::string("\xf8\x88")})
+            {
+                s_VerifyMatchesStreamWriter(Json::Value(value));
+
+                Json::Value object;
+                object[value] = value;
+                s_VerifyMatchesStreamWriter(object);
+            }
+        }
+
+        TEST_METHOD(ContainersMatchStreamWriter)
+        {
+            s_VerifyMatchesStreamWriter(Json::Value(Json::arrayValue));
+            s_VerifyMatchesStreamWriter(Json::Value(Json::objectValue));
+
+            Json::Value json;
+            json["b"] = 1;
+            json["a"]["nested"].append(Json::Value(Json::arrayValue));
+            json["a"]["nested"].append(Json::Value(Json::objectValue));
+            json["a"]["nested"].append("text");
+            json["aa"] = Json::Value();
+            json["B"] = 2.5;
+            for (int i = 0; i < 40; ++i)
+            {
+                json["long"].append(i);
+            }
+            s_VerifyMatchesStreamWriter(json);
+        }
+
+        TEST_METHOD(SamplesMatchStreamWriter)
+        {
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                const std::string cardJson = ReadSampleCard(samplePath);
+                Json::Value json;
+                try
+                {
+                    json = ParseUtil::GetJsonValueFromString(cardJson);
+                }
+                catch (const std::exception&)
+                {
+                    // Samples that aren't valid JSON
+                    continue;
+                }
+                s_VerifyMatchesStreamWriter(json);
+            }
+        }
+
+        TEST_METHOD(WriterAppendsToItsOutput)
+        {
+            JsonWriter writer;
+            writer.Write(Json::Value(1));
+            writer.Write(Json::Value("two"));
+            Assert::AreEqual(std::string("1\"two\""), writer.GetOutput());
+
+            writer.Clear();
+            writer.Write(Json::Value(Json::arrayValue));
+            Assert::AreEqual(std::string("[]"), writer.TakeOutput());
+        }
+    };
+}
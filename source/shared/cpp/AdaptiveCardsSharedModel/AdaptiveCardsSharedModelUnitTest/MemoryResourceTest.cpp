@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Container.h"
+#include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "SampleCards.h"
+#include "ShowCardAction.h"
+#include <memory_resource>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Arena that remembers how much was allocated from it and on which threads
+    class CountingArena : public std::pmr::monotonic_buffer_resource
+    {
+    public:
+        size_t allocationCount = 0;
+        std::unordered_set<std::thread::id> allocatingThreads;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocationCount;
+            allocatingThreads.insert(std::this_thread::get_id());
+            return std::pmr::monotonic_buffer_resource::do_allocate(bytes, alignment);
+        }
+    };
+
+    TEST_CLASS(MemoryResourceTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchHeapParse)
+        {
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                const std::string json = ReadSampleCard(samplePath);
+
+                // Labels declared with "labelFor" are remembered across parses, so parse once up front to make sure
+                // all of the parses below see the same label state.
+                DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+
+                const std::string expected = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+                Assert::AreEqual(expected, DescribeParse([&]() {
+                                     ParseContext context;
+                                     context.SetMemoryResource(std::make_shared<std::pmr::monotonic_buffer_resource>());
+                                     return AdaptiveCard::DeserializeFromString(json, "1.6", context);
+                                 }));
+            }
+        }
+
+        TEST_METHOD(ArenaLivesAsLongAsTheCard)
+        {
+            std::weak_ptr<CountingArena> weakArena;
+            std::shared_ptr<AdaptiveCard> card;
+            {
+                auto arena = std::make_shared<CountingArena>();
+                weakArena = arena;
+
+                ParseContext context;
+                context.SetMemoryResource(arena);
+                card = AdaptiveCard::DeserializeFromString(R"({"type": "AdaptiveCard", "version": "1.5",
+                    "body": [{"type": "Container", "items": [{"type": "TextBlock", "text": "Hello"}]}],
+                    "actions": [{"type": "Action.Submit", "title": "Send"}]})",
+                                                           "1.6",
+                                                           context)
+                           ->GetAdaptiveCard();
+
+                // The card, the container, the text block and the action
+                Assert::AreEqual(static_cast<size_t>(4), arena->allocationCount);
+            }
+
+            // Any element keeps the whole arena alive
+            auto textBlock = std::static_pointer_cast<Container>(card->GetBody().at(0))->GetItems().at(0);
+            card.reset();
+            Assert::IsFalse(weakArena.expired());
+
+            textBlock.reset();
+            Assert::IsTrue(weakArena.expired());
+        }
+
+        TEST_METHOD(ArenaIsOnlyUsedByTheParsingThread)
+        {
+            std::string items;
+            for (size_t i = 0; i < 200; ++i)
+            {
+                items.append(i == 0 ? "" : ",").append(R"({"type": "TextBlock", "text": "Item"})");
+            }
+            const std::string json = R"({"type": "AdaptiveCard", "version": "1.5", "body": [)" + items + R"(],
+                "actions": [{"type": "Action.ShowCard", "title": "More", "card": {"type": "AdaptiveCard", "body": []}}]})";
+
+            auto arena = std::make_shared<CountingArena>();
+            ParseContext context;
+            context.SetMemoryResource(arena);
+            context.SetParseThreadPool(std::make_shared<ParseThreadPool>(4));
+            auto card = AdaptiveCard::DeserializeFromString(json, "1.6", context)->GetAdaptiveCard();
+            Assert::AreEqual(static_cast<size_t>(200), card->GetBody().size());
+
+            context.SetParseThreadPool(nullptr);
+            context.SetDeferShowCardParsing(true);
+            card = AdaptiveCard::DeserializeFromString(json, "1.6", context)->GetAdaptiveCard();
+            std::thread([&card]() { std::static_pointer_cast<ShowCardAction>(card->GetActions().at(0))->GetCard(); }).join();
+
+            Assert::AreEqual(static_cast<size_t>(1), arena->allocatingThreads.size());
+            Assert::IsTrue(arena->allocatingThreads.count(std::this_thread::get_id()) == 1);
+        }
+    };
+}
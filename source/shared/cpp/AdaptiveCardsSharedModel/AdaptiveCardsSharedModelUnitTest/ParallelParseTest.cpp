@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "SampleCards.h"
+#include <atomic>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Returns a card with count items in its body, each built by getItem
+    static std::string s_GetWideCard(size_t count, const std::function<std::string(size_t)>& getItem)
+    {
+        std::string items;
+        for (size_t i = 0; i < count; ++i)
+        {
+            items.append(i == 0 ? "" : ",").append(getItem(i));
+        }
+        return R"({"type": "AdaptiveCard", "version": "1.5", "body": [)" + items + "]}";
+    }
+
+    static std::shared_ptr<ParseResult> s_ParseInParallel(const std::string& json, unsigned int threadCount)
+    {
+        ParseContext context;
+        context.SetParseThreadPool(std::make_shared<ParseThreadPool>(threadCount));
+        return AdaptiveCard::DeserializeFromString(json, "1.6", context);
+    }
+
+    static void s_VerifyMatchesSerialParse(const std::string& json)
+    {
+        // Labels declared with "labelFor" are remembered across parses, so parse once up front to make sure all of
+        // the parses below see the same label state.
+        DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+        const std::string expected = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+
+        for (unsigned int threadCount : {1, 2, 4, 8})
+        {
+            Assert::AreEqual(expected, DescribeParse([&]() { return s_ParseInParallel(json, threadCount); }));
+        }
+    }
+
+    TEST_CLASS(ParallelParseTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchSerialParse)
+        {
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                Logger::WriteMessage(("Verifying " + samplePath.string() + "\n").c_str());
+                s_VerifyMatchesSerialParse(ReadSampleCard(samplePath));
+            }
+        }
+
+        TEST_METHOD(WideCardsMatchSerialParse)
+        {
+            // A mix of elements with ids, nested collections, styles that affect bleed and padding, and warnings
+            s_VerifyMatchesSerialParse(s_GetWideCard(300, [](size_t i) {
+                switch (i % 5)
+                {
+                case 0:
+                    return R"({"type": "TextBlock", "id": "text)" + std::to_string(i) + R"(", "text": "Item )" + std::to_string(i) + R"("})";
+                case 1:
+                    return R"({"type": "Container", "style": "emphasis", "bleed": true, "items": [{"type": "TextBlock", "text": "Nested"},
+                        {"type": "Container", "style": "good", "items": [{"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png"}]}]})"s;
+                case 2:
+                    return R"({"type": "TextBlock", "text": ""})"s;
+                case 3:
+                    return R"({"type": "Input.Text", "id": "input)" + std::to_string(i) + R"(", "isRequired": true, "label": "Name"})";
+                default:
+                    return R"({"type": "ColumnSet", "columns": [{"type": "Column", "items": [{"type": "TextBlock", "text": "A"}]},
+                        {"type": "Column", "fallback": "drop", "items": [{"type": "TextBlock", "text": "B"}]}]})"s;
+                }
+            }));
+
+            // A table of many rows
+            std::string rows;
+            for (size_t i = 0; i < 200; ++i)
+            {
+                rows.append(i == 0 ? "" : ",")
+                    .append(R"({"type": "TableRow", "cells": [{"type": "TableCell", "items": [{"type": "TextBlock", "text": "Row )" +
+                            std::to_string(i) + R"("}]}, {"type": "TableCell", "items": [{"type": "TextBlock", "text": "Value"}]}]})");
+            }
+            s_VerifyMatchesSerialParse(R"({"type": "AdaptiveCard", "version": "1.5", "body": [{"type": "Table", "columns": [{"width": 1}, {"width": 2}], "rows": [)" +
+                                       rows + "]}]}");
+        }
+
+        TEST_METHOD(IdCollisionsMatchSerialParse)
+        {
+            // Collisions between runs, and within one
+            for (size_t duplicate : {10, 280})
+            {
+                s_VerifyMatchesSerialParse(s_GetWideCard(300, [duplicate](size_t i) {
+                    const size_t id = i == duplicate ? 5 : i;
+                    return R"({"type": "TextBlock", "id": "text)" + std::to_string(id) + R"(", "text": "Item"})";
+                }));
+            }
+
+            // Fallback content reusing its parent's id is allowed
+            s_VerifyMatchesSerialParse(s_GetWideCard(100, [](size_t i) {
+                return R"({"type": "Unknown", "id": "item)" + std::to_string(i) + R"(", "fallback": {"type": "TextBlock", "id": "item)" +
+                       std::to_string(i) + R"(", "text": "Fallback"}})";
+            }));
+        }
+
+        TEST_METHOD(StateChangesMatchSerialParse)
+        {
+            // A ShowCard's card changes the language that later siblings see, and labelFor labels are read back by
+            // later inputs
+            s_VerifyMatchesSerialParse(s_GetWideCard(100, [](size_t i) {
+                if (i == 20)
+                {
+                    return R"({"type": "ActionSet", "actions": [{"type": "Action.ShowCard", "title": "More",
+                        "card": {"type": "AdaptiveCard", "lang": "de", "body": []}}]})"s;
+                }
+                return R"({"type": "TextBlock", "text": "Item"})"s;
+            }));
+
+            s_VerifyMatchesSerialParse(s_GetWideCard(100, [](size_t i) {
+                if (i == 30)
+                {
+                    return R"({"type": "TextBlock", "text": "Label", "labelFor": "wideLabelInput"})"s;
+                }
+                if (i == 90)
+                {
+                    return R"({"type": "Input.Text", "id": "wideLabelInput", "label": "Own label"})"s;
+                }
+                return R"({"type": "TextBlock", "text": "Item"})"s;
+            }));
+        }
+
+        TEST_METHOD(ThreadPoolRunsEveryTask)
+        {
+            for (unsigned int threadCount : {1, 3})
+            {
+                ParseThreadPool threadPool(threadCount);
+                Assert::AreEqual(threadCount, threadPool.GetThreadCount());
+
+                // Nested runs mustn't wait on tasks that no thread is free to pick up
+                std::vector<std::atomic<unsigned int>> runs(64);
+                threadPool.RunParallel(8, [&](size_t outer) {
+                    threadPool.RunParallel(8, [&](size_t inner) { ++runs[outer * 8 + inner]; });
+                });
+
+                for (const auto& count : runs)
+                {
+                    Assert::AreEqual(1u, count.load());
+                }
+            }
+        }
+    };
+}
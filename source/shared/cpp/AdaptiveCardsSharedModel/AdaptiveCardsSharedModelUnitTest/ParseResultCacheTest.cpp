@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseResultCache.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include <atomic>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string s_GetCard(const std::string& text)
+    {
+        return R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": ")" + text + R"("}]})";
+    }
+
+    static void s_VerifyStatistics(const ParseResultCache& cache, size_t hits, size_t misses, size_t evictions, size_t entryCount)
+    {
+        const auto statistics = cache.GetStatistics();
+        Assert::AreEqual(hits, statistics.hits);
+        Assert::AreEqual(misses, statistics.misses);
+        Assert::AreEqual(evictions, statistics.evictions);
+        Assert::AreEqual(entryCount, statistics.entryCount);
+    }
+
+    TEST_CLASS(ParseResultCacheTest)
+    {
+    public:
+        TEST_METHOD(HitsShareTheParseResult)
+        {
+            ParseResultCache cache(1024 * 1024);
+            const std::string card = s_GetCard("hello");
+
+            const auto first = cache.DeserializeFromString(card, "1.0");
+            const auto second = cache.DeserializeFromString(card, "1.0");
+            Assert::IsTrue(first == second);
+            Assert::AreEqual(first->GetAdaptiveCard()->Serialize(), AdaptiveCard::DeserializeFromString(card, "1.0")->GetAdaptiveCard()->Serialize());
+            s_VerifyStatistics(cache, 1, 1, 0, 1);
+
+            cache.Clear();
+            Assert::IsTrue(first != cache.DeserializeFromString(card, "1.0"));
+            s_VerifyStatistics(cache, 1, 2, 0, 1);
+        }
+
+        TEST_METHOD(KeyCoversEverythingThatChangesTheParse)
+        {
+            ParseResultCache cache(1024 * 1024);
+            const std::string card = s_GetCard("hello");
+
+            ParseContext context;
+            const auto cached = cache.DeserializeFromString(card, "1.0", context);
+
+            // same registrations and language
+            ParseContext sameSettings(context.elementParserRegistration, context.actionParserRegistration);
+            Assert::IsTrue(cached == cache.DeserializeFromString(card, "1.0", sameSettings));
+
+            // different text, renderer version, language, ShowCard deferral or registrations
+            Assert::IsTrue(cached != cache.DeserializeFromString(s_GetCard("hello "), "1.0", sameSettings));
+            Assert::IsTrue(cached != cache.DeserializeFromString(card, "1.5", sameSettings));
+
+            ParseContext otherLanguage(context.elementParserRegistration, context.actionParserRegistration);
+            otherLanguage.SetLanguage("fr");
+            Assert::IsTrue(cached != cache.DeserializeFromString(card, "1.0", otherLanguage));
+
+            ParseContext deferShowCards(context.elementParserRegistration, context.actionParserRegistration);
+            deferShowCards.SetDeferShowCardParsing(true);
+            Assert::IsTrue(cached != cache.DeserializeFromString(card, "1.0", deferShowCards));
+
+            ParseContext otherElementRegistration(std::make_shared<ElementParserRegistration>(), context.actionParserRegistration);
+            Assert::IsTrue(cached != cache.DeserializeFromString(card, "1.0", otherElementRegistration));
+
+            ParseContext otherActionRegistration(context.elementParserRegistration, std::make_shared<ActionParserRegistration>());
+            Assert::IsTrue(cached != cache.DeserializeFromString(card, "1.0", otherActionRegistration));
+
+            s_VerifyStatistics(cache, 1, 7, 0, 7);
+        }
+
+        TEST_METHOD(LanguageFromTheCardDoesNotChangeTheKey)
+        {
+            ParseResultCache cache(1024 * 1024);
+            const std::string card = R"({"type": "AdaptiveCard", "version": "1.0", "lang": "de", "body": []})";
+
+            ParseContext first;
+            const auto cached = cache.DeserializeFromString(card, "1.0", first);
+            Assert::AreEqual(std::string("de"), first.GetLanguage());
+
+            ParseContext second(first.elementParserRegistration, first.actionParserRegistration);
+            Assert::IsTrue(cached == cache.DeserializeFromString(card, "1.0", second));
+        }
+
+        TEST_METHOD(HitsReportWarnings)
+        {
+            ParseResultCache cache(1024 * 1024);
+            const std::string card = R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": ""}]})";
+
+            ParseContext first;
+            cache.DeserializeFromString(card, "1.0", first);
+            Assert::AreEqual(static_cast<size_t>(1), first.warnings.size());
+
+            ParseContext second(first.elementParserRegistration, first.actionParserRegistration);
+            const auto parseResult = cache.DeserializeFromString(card, "1.0", second);
+            Assert::AreEqual(static_cast<size_t>(1), second.warnings.size());
+            Assert::AreEqual(static_cast<size_t>(1), parseResult->GetWarnings().size());
+            Assert::IsTrue(first.warnings[0] == second.warnings[0]);
+        }
+
+        TEST_METHOD(FailuresAreNotCached)
+        {
+            ParseResultCache cache(1024 * 1024);
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString("{", "1.0"); });
+            }
+            s_VerifyStatistics(cache, 0, 2, 0, 0);
+        }
+
+        TEST_METHOD(EvictsLeastRecentlyUsed)
+        {
+            const std::string a = s_GetCard("a");
+            const std::string b = s_GetCard("b");
+            const std::string c = s_GetCard("c");
+
+            // Find out what an entry costs, then make room for exactly two of them
+            ParseResultCache sizing(1024 * 1024);
+            sizing.DeserializeFromString(a, "1.0");
+            const size_t entrySize = sizing.GetStatistics().sizeInBytes;
+
+            ParseResultCache cache(2 * entrySize);
+            const auto cachedA = cache.DeserializeFromString(a, "1.0");
+            cache.DeserializeFromString(b, "1.0");
+            Assert::IsTrue(cachedA == cache.DeserializeFromString(a, "1.0"));
+
+            // b is now the least recently used
+            cache.DeserializeFromString(c, "1.0");
+            s_VerifyStatistics(cache, 1, 3, 1, 2);
+            Assert::AreEqual(2 * entrySize, cache.GetStatistics().sizeInBytes);
+            Assert::IsTrue(cachedA == cache.DeserializeFromString(a, "1.0"));
+
+            cache.DeserializeFromString(b, "1.0");
+            s_VerifyStatistics(cache, 2, 4, 2, 2);
+
+            // Shrinking the cache evicts right away, and entries larger than the cache are never stored
+            cache.SetMaxSizeInBytes(entrySize);
+            s_VerifyStatistics(cache, 2, 4, 3, 1);
+            cache.SetMaxSizeInBytes(entrySize - 1);
+            s_VerifyStatistics(cache, 2, 4, 4, 0);
+            cache.DeserializeFromString(a, "1.0");
+            s_VerifyStatistics(cache, 2, 5, 4, 0);
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetStatistics().sizeInBytes);
+        }
+
+        TEST_METHOD(ConcurrentUse)
+        {
+            ParseResultCache cache(64 * 1024);
+            constexpr unsigned int threadCount = 8;
+            constexpr unsigned int iterations = 200;
+
+            std::atomic<bool> wrongCard{false};
+            std::vector<std::thread> threads;
+            for (unsigned int t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&cache, &wrongCard, t]() {
+                    for (unsigned int i = 0; i < iterations; ++i)
+                    {
+                        const std::string text = std::to_string((i * 7 + t) % 50);
+                        const auto parseResult = cache.DeserializeFromString(s_GetCard(text), "1.0");
+                        const auto textBlock = std::static_pointer_cast<TextBlock>(parseResult->GetAdaptiveCard()->GetBody()[0]);
+                        if (textBlock->GetText() != text)
+                        {
+                            wrongCard = true;
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::IsFalse(wrongCard.load());
+            const auto statistics = cache.GetStatistics();
+            Assert::AreEqual(static_cast<size_t>(threadCount * iterations), statistics.hits + statistics.misses);
+            Assert::IsTrue(statistics.hits > 0);
+            Assert::IsTrue(statistics.sizeInBytes <= cache.GetMaxSizeInBytes());
+        }
+    };
+}
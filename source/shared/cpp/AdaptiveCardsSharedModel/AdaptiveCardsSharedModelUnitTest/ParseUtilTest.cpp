@@ -115,6 +115,24 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(propertyValue.asBool());
         }
 
+        TEST_METHOD(FindMemberTests)
+        {
+            auto jsonObj = s_GetValidJsonObject();
+            Assert::IsTrue(ParseUtil::FindMember(jsonObj, AdaptiveCardSchemaKey::Accent) == nullptr);
+            Assert::IsTrue(ParseUtil::GetMember(jsonObj, AdaptiveCardSchemaKey::Accent).isNull());
+
+            // The returned value must alias the member in the source tree rather than a copy of it
+            auto jsonObjWithAccent = s_GetJsonObjectWithAccent("[\"thing1\", \"thing2\"]"s);
+            const Json::Value* accent = ParseUtil::FindMember(jsonObjWithAccent, AdaptiveCardSchemaKey::Accent);
+            Assert::IsTrue(accent == &jsonObjWithAccent["accent"]);
+            Assert::IsTrue(&ParseUtil::GetMember(jsonObjWithAccent, AdaptiveCardSchemaKey::Accent) == accent);
+            Assert::IsTrue(&ParseUtil::GetArray(jsonObjWithAccent, AdaptiveCardSchemaKey::Accent) == accent);
+            Assert::IsTrue(&ParseUtil::ExtractJsonValue(jsonObjWithAccent, AdaptiveCardSchemaKey::Accent) == accent);
+
+            Json::Value nullValue;
+            Assert::IsTrue(ParseUtil::FindMember(nullValue, AdaptiveCardSchemaKey::Accent) == nullptr);
+        }
+
         TEST_METHOD(GetArrayTests)
         {
             bool throwsExpected = false;
@@ -121,5 +121,62 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParser.RemoveParser(CardElementTypeToString(CardElementType::Container)); });
             Assert::IsTrue((bool)elementParser.GetParser(CardElementTypeToString(CardElementType::Container)));
         }
+
+        TEST_METHOD(BuiltInTypesIgnoreCase)
+        {
+            ActionParserRegistration actionParser;
+            ElementParserRegistration elementParser;
+
+            Assert::IsTrue((bool)elementParser.GetParser("textblock"));
+            Assert::IsTrue((bool)elementParser.GetParser("INPUT.TEXT"));
+            Assert::IsTrue((bool)actionParser.GetParser("action.submit"));
+            Assert::IsTrue(!elementParser.GetParser("TextBlocks"));
+            Assert::IsTrue(!actionParser.GetParser("Action.Submi"));
+
+            ParseContext context;
+            std::shared_ptr<BaseCardElement> element;
+            Assert::IsTrue(elementParser.TryDeserialize(context, "textBlock", ParseUtil::GetJsonValueFromString(R"({"type": "TextBlock", "text": "Hi"})"), element));
+            Assert::IsTrue(element->GetElementType() == CardElementType::TextBlock);
+            Assert::IsFalse(elementParser.TryDeserialize(context, "notRegistered", Json::Value(Json::objectValue), element));
+        }
+
+        TEST_METHOD(DefaultRegistrationsAreSharedAndFixed)
+        {
+            class NullElementParser : public BaseCardElementParser
+            {
+            public:
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext&, const Json::Value&) override
+                {
+                    return nullptr;
+                }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext&, const std::string&) override
+                {
+                    return nullptr;
+                }
+            };
+
+            ParseContext first;
+            ParseContext second;
+            Assert::IsTrue(first.elementParserRegistration == second.elementParserRegistration);
+            Assert::IsTrue(first.actionParserRegistration == ActionParserRegistration::GetDefault());
+
+            const auto customParser = std::make_shared<NullElementParser>();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { first.elementParserRegistration->AddParser("Custom", customParser); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { first.elementParserRegistration->RemoveParser("CarouselPage"); });
+
+            // A new registration starts with the built-in parsers, and changing it leaves the default alone
+            const auto registration = std::make_shared<ElementParserRegistration>();
+            const auto builtInParser = std::static_pointer_cast<BaseCardElementParserWrapper>(registration->GetParser("TextBlock"));
+            const auto defaultParser = std::static_pointer_cast<BaseCardElementParserWrapper>(first.elementParserRegistration->GetParser("TextBlock"));
+            Assert::IsTrue(builtInParser->GetActualParser() == defaultParser->GetActualParser());
+
+            registration->AddParser("Custom", customParser);
+            registration->RemoveParser("CarouselPage");
+            Assert::IsTrue((bool)registration->GetParser("Custom"));
+            Assert::IsTrue(!registration->GetParser("CarouselPage"));
+            Assert::IsTrue(!first.elementParserRegistration->GetParser("Custom"));
+            Assert::IsTrue((bool)first.elementParserRegistration->GetParser("CarouselPage"));
+            Assert::IsTrue((bool)std::make_shared<ElementParserRegistration>()->GetParser("CarouselPage"));
+        }
     };
 }
@@ -0,0 +1,691 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "BatchDeserializer.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FeatureRegistration.h"
+#include "Image.h"
+#include "MappedFile.h"
+#include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <memory_resource>
+#include <new>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace
+{
+std::atomic<size_t> s_allocationCount{0};
+std::atomic<size_t> s_allocatedBytes{0};
+}
+
+// Count every allocation made by this test binary so the parse benchmarks can report allocations per card.
+void* operator new(std::size_t size)
+{
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* allocation = std::malloc(size == 0 ? 1 : size))
+    {
+        return allocation;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* allocation) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete(void* allocation, std::size_t) noexcept
+{
+    std::free(allocation);
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Returns the body of a typical chat card: a header, a fact set, a two column layout and an action set, repeated
+    // until the serialized items reach at least targetSize bytes.
+    static std::string s_GetChatCardItems(size_t targetSize)
+    {
+        const std::string block = R"({"type": "Container", "style": "emphasis", "items": [
+            {"type": "TextBlock", "text": "Weekly status for **project Contoso**", "size": "Medium", "weight": "Bolder", "wrap": true},
+            {"type": "FactSet", "facts": [{"title": "Owner", "value": "Miriam Graham"}, {"title": "Due", "value": "{{DATE(2017-02-14T06:08:39Z, SHORT)}}"}]},
+            {"type": "ColumnSet", "columns": [
+                {"type": "Column", "width": "auto", "items": [{"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png", "size": "Small", "style": "Person"}]},
+                {"type": "Column", "width": "stretch", "items": [{"type": "TextBlock", "text": "Updated the rollout plan and _shared_ it with the team.", "wrap": true, "isSubtle": true}]}]},
+            {"type": "ActionSet", "actions": [{"type": "Action.OpenUrl", "title": "View", "url": "https://adaptivecards.io"}, {"type": "Action.Submit", "title": "Acknowledge", "data": {"id": 42, "tags": ["a", "b"]}}]}]})";
+
+        std::string items;
+        while (items.size() < targetSize)
+        {
+            items.append(items.empty() ? "" : ",").append(block);
+        }
+        return items;
+    }
+
+    // Wraps items in depth nested containers and returns the resulting card.
+    static std::string s_GetChatCard(const std::string& items, unsigned int depth)
+    {
+        std::string body = items;
+        for (unsigned int i = 0; i < depth; ++i)
+        {
+            body = R"({"type": "Container", "items": [)" + body + "]}";
+        }
+        return R"({"type": "AdaptiveCard", "version": "1.5", "body": [)" + body + "]}";
+    }
+
+    static size_t s_CountDeserializeAllocations(const Json::Value& json)
+    {
+        ParseContext context;
+        const size_t before = s_allocationCount.load();
+        auto parseResult = AdaptiveCard::Deserialize(json, "1.5", context);
+        const size_t after = s_allocationCount.load();
+        Assert::IsTrue(parseResult->GetAdaptiveCard() != nullptr);
+        return after - before;
+    }
+
+    // Logs the heap memory taken by one default constructed T, and returns the number of allocations it takes
+    template <typename T> static size_t s_ReportElementMemoryUsage(const std::string& typeName)
+    {
+        constexpr size_t count = 1000;
+        std::vector<std::shared_ptr<T>> elements;
+        elements.reserve(count);
+
+        const size_t allocationsBefore = s_allocationCount.load();
+        const size_t bytesBefore = s_allocatedBytes.load();
+        for (size_t i = 0; i < count; ++i)
+        {
+            elements.push_back(std::make_shared<T>());
+        }
+        const size_t allocations = (s_allocationCount.load() - allocationsBefore) / count;
+        const size_t bytes = (s_allocatedBytes.load() - bytesBefore) / count;
+
+        Logger::WriteMessage((typeName + ": sizeof " + std::to_string(sizeof(T)) + ", " + std::to_string(allocations) +
+                              " allocations and " + std::to_string(bytes) + " heap bytes per instance\n")
+                                 .c_str());
+        return allocations;
+    }
+
+    // Times ToString and FromString over every named value of an enum, and checks that they round trip without
+    // allocating. Some values share a name, so the round trip compares names.
+    template <typename T>
+    static void s_BenchmarkEnum(const std::string& enumName,
+                                const EnumHelpers::EnumMapping<T>& mapping,
+                                const std::string& (*toString)(T),
+                                T (*fromString)(const std::string&))
+    {
+        constexpr unsigned int iterations = 2000;
+        const std::vector<T> values = mapping.values();
+        std::vector<std::string> names;
+        for (T value : values)
+        {
+            names.push_back(toString(value));
+        }
+
+        size_t checksum = 0;
+        const size_t allocationsBefore = s_allocationCount.load();
+        const auto toStringStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            for (T value : values)
+            {
+                checksum += toString(value).size();
+            }
+        }
+        const auto fromStringStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            for (const auto& name : names)
+            {
+                checksum += static_cast<size_t>(fromString(name));
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        Assert::AreEqual(allocationsBefore, s_allocationCount.load());
+        Assert::IsTrue(checksum > 0);
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            Assert::AreEqual(names[i], toString(fromString(names[i])));
+        }
+
+        const auto lookups = static_cast<double>(iterations) * values.size();
+        const auto toStringNs = std::chrono::duration<double, std::nano>(fromStringStart - toStringStart).count() / lookups;
+        const auto fromStringNs = std::chrono::duration<double, std::nano>(end - fromStringStart).count() / lookups;
+        Logger::WriteMessage((enumName + " (" + std::to_string(values.size()) + " names): ToString " +
+                              std::to_string(toStringNs) + " ns, FromString " + std::to_string(fromStringNs) + " ns" +
+                              "\n")
+                                 .c_str());
+    }
+
+#define BENCHMARK_ENUM(ENUMTYPE) s_BenchmarkEnum<ENUMTYPE>(#ENUMTYPE, EnumHelpers::get##ENUMTYPE##Enum(), ENUMTYPE##ToString, ENUMTYPE##FromString)
+
+    TEST_CLASS(PerformanceTests)
+    {
+    public:
+        TEST_METHOD(NestingDoesNotCopySubtrees)
+        {
+            // Each extra level of nesting should only cost the allocations for the container itself. If subtrees
+            // were copied on the way down, the cost of each level would grow with the size of the card.
+            const std::string smallItems = s_GetChatCardItems(5 * 1024);
+            const std::string largeItems = s_GetChatCardItems(50 * 1024);
+
+            // Parse once first so that one-time setup, such as building each type's known property table, isn't
+            // counted against whichever card happens to be parsed first
+            s_CountDeserializeAllocations(ParseUtil::GetJsonValueFromString(s_GetChatCard(smallItems, 8)));
+
+            const size_t smallShallow = s_CountDeserializeAllocations(ParseUtil::GetJsonValueFromString(s_GetChatCard(smallItems, 1)));
+            const size_t smallDeep = s_CountDeserializeAllocations(ParseUtil::GetJsonValueFromString(s_GetChatCard(smallItems, 8)));
+            const size_t largeShallow = s_CountDeserializeAllocations(ParseUtil::GetJsonValueFromString(s_GetChatCard(largeItems, 1)));
+            const size_t largeDeep = s_CountDeserializeAllocations(ParseUtil::GetJsonValueFromString(s_GetChatCard(largeItems, 8)));
+
+            Assert::IsTrue(largeShallow > smallShallow);
+            Assert::AreEqual(smallDeep - smallShallow, largeDeep - largeShallow);
+        }
+
+        TEST_METHOD(ChatCardDeserializeBenchmark)
+        {
+            constexpr unsigned int iterations = 20;
+            for (size_t targetSize : {5 * 1024, 20 * 1024, 50 * 1024})
+            {
+                const std::string cardJson = s_GetChatCard(s_GetChatCardItems(targetSize), 1);
+                const Json::Value json = ParseUtil::GetJsonValueFromString(cardJson);
+
+                size_t allocations = 0;
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    allocations += s_CountDeserializeAllocations(json);
+                }
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                Logger::WriteMessage(("Deserialize " + std::to_string(cardJson.size() / 1024) + " KB chat card: " +
+                                      std::to_string(allocations / iterations) + " allocations, " +
+                                      std::to_string(elapsed.count() / iterations) + " us\n")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(DeserializeFromFileBenchmark)
+        {
+            // Only the file reading and JSON parsing in front of Deserialize changed, so time that on its own as well
+            // as the whole call.
+            constexpr unsigned int iterations = 20;
+            const auto path = std::filesystem::temp_directory_path() / "DeserializeFromFileBenchmark.json";
+            for (size_t targetSize : {50 * 1024, 1024 * 1024})
+            {
+                const std::string cardJson = s_GetChatCard(s_GetChatCardItems(targetSize), 1);
+                std::ofstream(path, std::ios::binary | std::ios::trunc) << cardJson;
+
+                // What DeserializeFromFile used to do: extract the file through an ifstream
+                auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    std::ifstream jsonFileStream(path);
+                    Json::Value root;
+                    jsonFileStream >> root;
+                    Assert::IsTrue(root.isObject());
+                }
+                const auto streamElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    const MappedFile file(path.string());
+                    Assert::IsTrue(ParseUtil::GetJsonValueFromBuffer(file.GetData(), file.GetSize()).isObject());
+                }
+                const auto mappedElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    Assert::IsTrue(AdaptiveCard::DeserializeFromFile(path.string(), "1.5")->GetAdaptiveCard() != nullptr);
+                }
+                const auto deserializeElapsed =
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                Logger::WriteMessage(("Read " + std::to_string(cardJson.size() / 1024) + " KB chat card: ifstream " +
+                                      std::to_string(streamElapsed.count() / iterations) + " us, mapped " +
+                                      std::to_string(mappedElapsed.count() / iterations) + " us, whole DeserializeFromFile " +
+                                      std::to_string(deserializeElapsed.count() / iterations) + " us\n")
+                                         .c_str());
+            }
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(SnapshotLoadBenchmark)
+        {
+            constexpr unsigned int iterations = 20;
+            for (size_t targetSize : {5 * 1024, 50 * 1024})
+            {
+                const std::string cardJson = s_GetChatCard(s_GetChatCardItems(targetSize), 1);
+                const std::string snapshot = AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard()->SerializeToSnapshot();
+
+                auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    Assert::IsTrue(AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard() != nullptr);
+                }
+                const auto stringElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    Assert::IsTrue(AdaptiveCard::DeserializeFromSnapshot(snapshot.data(), snapshot.size(), "1.5")->GetAdaptiveCard() != nullptr);
+                }
+                const auto snapshotElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                Logger::WriteMessage(("Load " + std::to_string(cardJson.size() / 1024) + " KB chat card (" +
+                                      std::to_string(snapshot.size() / 1024) + " KB snapshot): DeserializeFromString " +
+                                      std::to_string(stringElapsed.count() / iterations) + " us, DeserializeFromSnapshot " +
+                                      std::to_string(snapshotElapsed.count() / iterations) + " us\n")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(DeferredShowCardBenchmark)
+        {
+            // A card whose actions each expand to a full chat card, of which a user typically opens one or none
+            constexpr unsigned int iterations = 20;
+            constexpr unsigned int showCardCount = 10;
+            const std::string subcard = s_GetChatCard(s_GetChatCardItems(2 * 1024), 1);
+
+            std::string actions;
+            for (unsigned int i = 0; i < showCardCount; ++i)
+            {
+                actions.append(i == 0 ? "" : ",")
+                    .append(R"({"type": "Action.ShowCard", "title": "Details )" + std::to_string(i) + R"(", "card": )" + subcard + "}");
+            }
+            const std::string cardJson = R"({"type": "AdaptiveCard", "version": "1.5", "body": [{"type": "TextBlock", "text": "Summary"}], "actions": [)" +
+                                         actions + "]}";
+            const Json::Value json = ParseUtil::GetJsonValueFromString(cardJson);
+
+            for (bool defer : {false, true})
+            {
+                size_t allocations = 0;
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    ParseContext context;
+                    context.SetDeferShowCardParsing(defer);
+
+                    const size_t before = s_allocationCount.load();
+                    auto parseResult = AdaptiveCard::Deserialize(json, "1.5", context);
+                    allocations += s_allocationCount.load() - before;
+                    Assert::AreEqual(static_cast<size_t>(showCardCount), parseResult->GetAdaptiveCard()->GetActions().size());
+                }
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                Logger::WriteMessage(("Deserialize " + std::to_string(cardJson.size() / 1024) + " KB card with " +
+                                      std::to_string(showCardCount) + " ShowCards (" + (defer ? "deferred" : "eager") + "): " +
+                                      std::to_string(allocations / iterations) + " allocations, " +
+                                      std::to_string(elapsed.count() / iterations) + " us\n")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(ParallelParseBenchmark)
+        {
+            constexpr unsigned int iterations = 10;
+            const std::string cardJson = s_GetChatCard(s_GetChatCardItems(500 * 1024), 0);
+            const Json::Value json = ParseUtil::GetJsonValueFromString(cardJson);
+
+            long long singleThreadTime = 0;
+            for (unsigned int threadCount : {1, 2, 4, 8})
+            {
+                const auto threadPool = std::make_shared<ParseThreadPool>(threadCount);
+
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    ParseContext context;
+                    context.SetParseThreadPool(threadPool);
+                    Assert::IsTrue(AdaptiveCard::Deserialize(json, "1.5", context)->GetAdaptiveCard() != nullptr);
+                }
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                if (threadCount == 1)
+                {
+                    singleThreadTime = elapsed.count();
+                }
+                Logger::WriteMessage(("Deserialize " + std::to_string(cardJson.size() / 1024) + " KB wide card on " +
+                                      std::to_string(threadCount) + " threads: " + std::to_string(elapsed.count() / iterations) +
+                                      " us, speedup " + std::to_string(static_cast<double>(singleThreadTime) / elapsed.count()) + "\n")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(BatchDeserializeBenchmark)
+        {
+            constexpr unsigned int iterations = 5;
+            std::vector<std::string> cards;
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                cards.push_back(ReadSampleCard(samplePath));
+            }
+
+            const auto serialStart = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                for (const auto& card : cards)
+                {
+                    try
+                    {
+                        AdaptiveCard::DeserializeFromString(card, "1.6");
+                    }
+                    catch (const std::exception&)
+                    {
+                    }
+                }
+            }
+            const auto serialElapsed =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - serialStart);
+            const long long serialCardsPerSecond = 1000000LL * iterations * cards.size() / serialElapsed.count();
+            Logger::WriteMessage(("DeserializeFromString over " + std::to_string(cards.size()) + " sample cards: " +
+                                  std::to_string(serialCardsPerSecond) + " cards/s\n")
+                                     .c_str());
+
+            for (unsigned int threadCount : {1, 2, 4, 8})
+            {
+                const BatchDeserializer batchDeserializer(std::make_shared<ParseThreadPool>(threadCount));
+
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int i = 0; i < iterations; ++i)
+                {
+                    Assert::AreEqual(cards.size(), batchDeserializer.DeserializeFromStrings(cards, "1.6").size());
+                }
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                const long long cardsPerSecond = 1000000LL * iterations * cards.size() / elapsed.count();
+                Logger::WriteMessage(("BatchDeserializer over " + std::to_string(cards.size()) + " sample cards on " +
+                                      std::to_string(threadCount) + " threads: " + std::to_string(cardsPerSecond) +
+                                      " cards/s, speedup " + std::to_string(static_cast<double>(cardsPerSecond) / serialCardsPerSecond) + "\n")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(ArenaParseBenchmark)
+        {
+            constexpr unsigned int iterations = 20;
+            for (size_t targetSize : {5 * 1024, 50 * 1024, 500 * 1024})
+            {
+                const std::string cardJson = s_GetChatCard(s_GetChatCardItems(targetSize), 1);
+                const Json::Value json = ParseUtil::GetJsonValueFromString(cardJson);
+
+                for (bool useArena : {false, true})
+                {
+                    size_t allocations = 0;
+                    const auto start = std::chrono::steady_clock::now();
+                    for (unsigned int i = 0; i < iterations; ++i)
+                    {
+                        const size_t before = s_allocationCount.load();
+                        {
+                            ParseContext context;
+                            if (useArena)
+                            {
+                                context.SetMemoryResource(std::make_shared<std::pmr::monotonic_buffer_resource>());
+                            }
+                            Assert::IsTrue(AdaptiveCard::Deserialize(json, "1.5", context)->GetAdaptiveCard() != nullptr);
+                        }
+                        allocations += s_allocationCount.load() - before;
+                    }
+                    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+                    Logger::WriteMessage(("Deserialize and release " + std::to_string(cardJson.size() / 1024) + " KB card (" +
+                                          (useArena ? "arena" : "heap") + "): " + std::to_string(allocations / iterations) +
+                                          " allocations, " + std::to_string(elapsed.count() / iterations) + " us\n")
+                                             .c_str());
+                }
+            }
+        }
+
+        TEST_METHOD(ElementMemoryUsage)
+        {
+            // Known property names are shared by every element of a type, so constructing an element should only
+            // allocate the element itself plus whatever it owns outright (such as a TextBlock's text properties).
+            Assert::IsTrue(s_ReportElementMemoryUsage<TextBlock>("TextBlock") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<Container>("Container") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<ColumnSet>("ColumnSet") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<Image>("Image") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<TextInput>("TextInput") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<SubmitAction>("SubmitAction") <= 2);
+            Assert::IsTrue(s_ReportElementMemoryUsage<AdaptiveCard>("AdaptiveCard") <= 2);
+        }
+
+        TEST_METHOD(EnumMappingBenchmark)
+        {
+            BENCHMARK_ENUM(AdaptiveCardSchemaKey);
+            BENCHMARK_ENUM(CardElementType);
+            BENCHMARK_ENUM(InlineElementType);
+            BENCHMARK_ENUM(TextStyle);
+            BENCHMARK_ENUM(TextSize);
+            BENCHMARK_ENUM(TextWeight);
+            BENCHMARK_ENUM(FontType);
+            BENCHMARK_ENUM(ForegroundColor);
+            BENCHMARK_ENUM(HorizontalAlignment);
+            BENCHMARK_ENUM(HorizontalContentAlignment);
+            BENCHMARK_ENUM(VerticalAlignment);
+            BENCHMARK_ENUM(VerticalContentAlignment);
+            BENCHMARK_ENUM(IconSize);
+            BENCHMARK_ENUM(IconStyle);
+            BENCHMARK_ENUM(ImageFillMode);
+            BENCHMARK_ENUM(ItemFit);
+            BENCHMARK_ENUM(LayoutContainerType);
+            BENCHMARK_ENUM(ImageStyle);
+            BENCHMARK_ENUM(ImageSize);
+            BENCHMARK_ENUM(ImageFitMode);
+            BENCHMARK_ENUM(TextInputStyle);
+            BENCHMARK_ENUM(ActionType);
+            BENCHMARK_ENUM(ActionAlignment);
+            BENCHMARK_ENUM(AssociatedInputs);
+            BENCHMARK_ENUM(ChoiceSetStyle);
+            BENCHMARK_ENUM(SeparatorThickness);
+            BENCHMARK_ENUM(Spacing);
+            BENCHMARK_ENUM(ActionsOrientation);
+            BENCHMARK_ENUM(ActionMode);
+            BENCHMARK_ENUM(ActionRole);
+            BENCHMARK_ENUM(ContainerStyle);
+            BENCHMARK_ENUM(Mode);
+            BENCHMARK_ENUM(ACTheme);
+            BENCHMARK_ENUM(ErrorStatusCode);
+            BENCHMARK_ENUM(IconPlacement);
+            BENCHMARK_ENUM(PageAnimation);
+            BENCHMARK_ENUM(HeightType);
+            BENCHMARK_ENUM(RatingSize);
+            BENCHMARK_ENUM(RatingColor);
+            BENCHMARK_ENUM(RatingStyle);
+            BENCHMARK_ENUM(TargetWidthType);
+            BENCHMARK_ENUM(ValueChangedActionType);
+            BENCHMARK_ENUM(IconPosition);
+            BENCHMARK_ENUM(Shape);
+            BENCHMARK_ENUM(LabelPosition);
+            BENCHMARK_ENUM(ProgressSize);
+            BENCHMARK_ENUM(BadgeStyle);
+            BENCHMARK_ENUM(BadgeSize);
+            BENCHMARK_ENUM(BadgeAppearance);
+            BENCHMARK_ENUM(ProgressBarColor);
+            BENCHMARK_ENUM(ReferenceType);
+            BENCHMARK_ENUM(ReferenceIcon);
+        }
+
+        TEST_METHOD(SmallCardParseLatency)
+        {
+            // Small cards are dominated by fixed costs, such as setting up the ParseContext, rather than by the
+            // elements themselves
+            const std::string cardJson = R"({"type": "AdaptiveCard", "version": "1.5", "body": [
+                {"type": "TextBlock", "text": "Your meeting starts in 5 minutes", "wrap": true}],
+                "actions": [{"type": "Action.Submit", "title": "Join"}]})";
+            constexpr unsigned int iterations = 2000;
+
+            AdaptiveCard::DeserializeFromString(cardJson, "1.6");
+            const size_t allocationsBefore = s_allocationCount.load();
+            const auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                AdaptiveCard::DeserializeFromString(cardJson, "1.6");
+            }
+            const auto parseElapsed = std::chrono::steady_clock::now() - start;
+            const size_t parseAllocations = s_allocationCount.load() - allocationsBefore;
+
+            const size_t contextAllocationsBefore = s_allocationCount.load();
+            const auto contextStart = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                ParseContext context;
+            }
+            const auto contextElapsed = std::chrono::steady_clock::now() - contextStart;
+            const size_t contextAllocations = s_allocationCount.load() - contextAllocationsBefore;
+
+            Logger::WriteMessage(("Small card: " + std::to_string(parseAllocations / iterations) + " allocations, " +
+                                  std::to_string(std::chrono::duration<double, std::micro>(parseElapsed).count() / iterations) +
+                                  " us per parse; ParseContext(): " + std::to_string(contextAllocations / iterations) + " allocations, " +
+                                  std::to_string(std::chrono::duration<double, std::micro>(contextElapsed).count() / iterations) + " us\n")
+                                     .c_str());
+        }
+
+        TEST_METHOD(SampleCorpusAllocations)
+        {
+            std::vector<std::string> cards;
+            for (const auto& samplePath : GetSampleCardPaths())
+            {
+                cards.push_back(ReadSampleCard(samplePath));
+            }
+
+            const auto parseAll = [&cards]() {
+                for (const auto& cardJson : cards)
+                {
+                    try
+                    {
+                        AdaptiveCard::DeserializeFromString(cardJson, "1.6");
+                    }
+                    catch (const std::exception&)
+                    {
+                        // Some samples are meant to fail
+                    }
+                }
+            };
+            parseAll();
+
+            const size_t allocationsBefore = s_allocationCount.load();
+            const size_t bytesBefore = s_allocatedBytes.load();
+            const auto start = std::chrono::steady_clock::now();
+            parseAll();
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+            Logger::WriteMessage(("Parsed " + std::to_string(cards.size()) + " sample cards: " +
+                                  std::to_string(s_allocationCount.load() - allocationsBefore) + " allocations, " +
+                                  std::to_string((s_allocatedBytes.load() - bytesBefore) / 1024) + " KB, " +
+                                  std::to_string(elapsed.count()) + " us\n")
+                                     .c_str());
+        }
+
+        TEST_METHOD(SerializeThroughput)
+        {
+            constexpr unsigned int iterations = 10;
+            const auto card = AdaptiveCard::DeserializeFromString(s_GetChatCard(s_GetChatCardItems(1024 * 1024), 1), "1.6")->GetAdaptiveCard();
+            const size_t outputSize = card->Serialize().size();
+
+            const auto throughput = [outputSize](std::chrono::steady_clock::duration elapsed) {
+                return std::to_string(outputSize * iterations / std::chrono::duration<double>(elapsed).count() / (1024 * 1024));
+            };
+
+            // What ParseUtil::JsonToString used to do with the card's JSON
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+                std::ostringstream outStream;
+                writer->write(card->SerializeToJsonValue(), &outStream);
+                outStream << std::endl;
+                Assert::AreEqual(outputSize, outStream.str().size());
+            }
+            const auto streamElapsed = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                Assert::AreEqual(outputSize, card->Serialize().size());
+            }
+            const auto serializeElapsed = std::chrono::steady_clock::now() - start;
+
+            Logger::WriteMessage(("Serialize " + std::to_string(outputSize / 1024) + " KB chat card: StreamWriter " +
+                                  throughput(streamElapsed) + " MB/s, Serialize " + throughput(serializeElapsed) + " MB/s\n")
+                                     .c_str());
+        }
+
+        TEST_METHOD(RequirementsBenchmark)
+        {
+            // A card whose every element declares requirements, as cards written for several hosts tend to
+            std::string items;
+            for (unsigned int i = 0; i < 500; ++i)
+            {
+                items.append(items.empty() ? "" : ",")
+                    .append(R"({"type": "Container", "requires": {"adaptiveCards": "1.2", "acTest": "1.0.3"}, "items": [
+                        {"type": "TextBlock", "text": "Hello", "requires": {"ACTEST": "1.0", "adaptiveCards": "1.0.0.0"}},
+                        {"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png", "requires": {"acTest": "2"}}]})");
+            }
+            const std::string cardJson = s_GetChatCard(items, 0);
+            constexpr unsigned int iterations = 20;
+
+            AdaptiveCard::DeserializeFromString(cardJson, "1.5");
+            auto start = std::chrono::steady_clock::now();
+            std::shared_ptr<AdaptiveCard> card;
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                card = AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard();
+            }
+            const auto parseElapsed = std::chrono::steady_clock::now() - start;
+
+            std::vector<const BaseElement*> elements;
+            for (const auto& element : card->GetBody())
+            {
+                elements.push_back(element.get());
+                for (const auto& item : std::static_pointer_cast<Container>(element)->GetItems())
+                {
+                    elements.push_back(item.get());
+                }
+            }
+
+            FeatureRegistration featureRegistration;
+            featureRegistration.AddFeature("acTest", "1.5");
+
+            const size_t allocationsBefore = s_allocationCount.load();
+            size_t met = 0;
+            start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < iterations; ++i)
+            {
+                for (const auto* element : elements)
+                {
+                    met += element->MeetsRequirements(featureRegistration) ? 1 : 0;
+                }
+            }
+            const auto checkElapsed = std::chrono::steady_clock::now() - start;
+            Assert::AreEqual(allocationsBefore, s_allocationCount.load());
+            Assert::AreEqual(static_cast<size_t>(1000 * iterations), met);
+
+            Logger::WriteMessage(("Card with " + std::to_string(elements.size()) + " elements declaring requirements: " +
+                                  std::to_string(std::chrono::duration<double, std::milli>(parseElapsed).count() / iterations) +
+                                  " ms per parse, MeetsRequirements " +
+                                  std::to_string(std::chrono::duration<double, std::nano>(checkElapsed).count() /
+                                                 (iterations * elements.size())) +
+                                  " ns per element\n")
+                                     .c_str());
+        }
+    };
+}
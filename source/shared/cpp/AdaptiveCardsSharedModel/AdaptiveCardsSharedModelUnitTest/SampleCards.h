@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "AdaptiveCardParseException.h"
+#include "AdaptiveCardParseWarning.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Returns the path of every card under the repository's samples folder, in a stable order
+    inline std::vector<std::filesystem::path> GetSampleCardPaths()
+    {
+        const std::filesystem::path samplesPath =
+            std::filesystem::path(__FILE__).parent_path() / ".." / ".." / ".." / ".." / ".." / "samples";
+
+        std::vector<std::filesystem::path> paths;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesPath))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".json")
+            {
+                paths.push_back(entry.path());
+            }
+        }
+
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+    inline std::string ReadSampleCard(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    // Describes everything observable about a parse: the serialized card and warnings, or the error it threw. Used to
+    // check that different ways of loading a card give the same result.
+    inline std::string DescribeParse(const std::function<std::shared_ptr<AdaptiveCards::ParseResult>()>& parse)
+    {
+        try
+        {
+            auto parseResult = parse();
+            std::string description = parseResult->GetAdaptiveCard()->Serialize();
+            for (const auto& warning : parseResult->GetWarnings())
+            {
+                description.append("warning ")
+                    .append(std::to_string(static_cast<int>(warning->GetStatusCode())))
+                    .append(": ")
+                    .append(warning->GetReason())
+                    .append("\n");
+            }
+            return description;
+        }
+        catch (const AdaptiveCards::AdaptiveCardParseException& e)
+        {
+            return "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + ": " + e.GetReason();
+        }
+        catch (const std::exception& e)
+        {
+            return std::string("exception: ") + e.what();
+        }
+    }
+}
@@ -6,6 +6,7 @@
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
+using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
@@ -71,6 +72,31 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("0xF"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("F"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.c"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("2147483648"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.4294967296"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.2.3.4.5"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version(".1"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1..2"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("+1"); });
+        }
+
+        TEST_METHOD(TryParseTest)
+        {
+            SemanticVersion version(1, 2);
+            Assert::IsTrue(SemanticVersion::TryParse("2147483647.0.0.7", version));
+            Assert::AreEqual(2147483647U, version.GetMajor());
+            Assert::AreEqual(0U, version.GetMinor());
+            Assert::AreEqual(0U, version.GetBuild());
+            Assert::AreEqual(7U, version.GetRevision());
+            Assert::IsTrue(version == SemanticVersion(2147483647, 0, 0, 7));
+
+            // a failed parse leaves the result alone
+            Assert::IsFalse(SemanticVersion::TryParse("*", version));
+            Assert::IsFalse(SemanticVersion::TryParse("1.2.", version));
+            Assert::IsFalse(SemanticVersion::TryParse("2147483648", version));
+            Assert::IsTrue(version == SemanticVersion(2147483647, 0, 0, 7));
+
+            Assert::AreEqual("1.5.0.0"s, static_cast<std::string>(SemanticVersion("1.5")));
         }
 
         TEST_METHOD(CompareTest)
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "SampleCards.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static void s_VerifyStreamingMatches(const std::string& json, const std::string& rendererVersion = "1.6")
+    {
+        // Labels declared with "labelFor" are remembered across parses, so parse once up front to make sure both of
+        // the parses below see the same label state.
+        DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, rendererVersion); });
+
+        const std::string expected = DescribeParse([&]() { return AdaptiveCard::DeserializeFromString(json, rendererVersion); });
+        const std::string actual =
+            DescribeParse([&]() { return AdaptiveCard::DeserializeFromStringStreaming(json, rendererVersion); });
+        Assert::AreEqual(expected, actual);
+    }
+
+    TEST_CLASS(StreamingDeserializationTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchDomDeserialization)
+        {
+            const auto samplePaths = GetSampleCardPaths();
+            Assert::IsFalse(samplePaths.empty());
+
+            for (const auto& samplePath : samplePaths)
+            {
+                Logger::WriteMessage(("Verifying " + samplePath.string() + "\n").c_str());
+                s_VerifyStreamingMatches(ReadSampleCard(samplePath));
+            }
+        }
+
+        TEST_METHOD(IdCollisionsAndBleedMatchDomDeserialization)
+        {
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.2",
+                "actions": [{"type": "Action.Submit", "id": "dup"}],
+                "body": [
+                    {"type": "TextBlock", "id": "dup", "text": "first"},
+                    {"type": "Container", "bleed": true, "style": "emphasis", "items": [{"type": "TextBlock", "text": "middle"}]},
+                    {"type": "TextBlock", "id": "dup", "text": "last"}]})");
+        }
+
+        TEST_METHOD(UnusualBodiesMatchDomDeserialization)
+        {
+            // body is not an array
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": {"type": "TextBlock", "text": "hi"}})");
+            // duplicated body, the last one wins
+            s_VerifyStreamingMatches(
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "first"}], "body": [{"type": "TextBlock", "text": "second"}]})");
+            s_VerifyStreamingMatches(
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "first"}], "body": null})");
+            // empty body, non object elements and unknown elements
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": []})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": ["text"]})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "Custom", "payload": [1, 2.5e3, -0.5, true, null]}]})");
+            // escaped keys and values
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "😀 \"quoted\"\n"}]})");
+            // requirements not met, so only the fallback is used
+            s_VerifyStreamingMatches(
+                R"({"type": "AdaptiveCard", "version": "1.0", "requires": {"unknownFeature": "1.0"}, "fallback": {"type": "TextBlock", "text": "fallback"}, "body": [{"type": "TextBlock", "text": "body"}]})");
+        }
+
+        TEST_METHOD(MalformedJsonMatchesDomDeserialization)
+        {
+            s_VerifyStreamingMatches("");
+            s_VerifyStreamingMatches("[]");
+            s_VerifyStreamingMatches("{}");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "hi"})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "\q"}]})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "hi",}]})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": 01}]})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", /* comment */ "version": "1.0", "body": []})");
+            s_VerifyStreamingMatches(R"({"type": "AdaptiveCard", "version": "1.0", "body": []} trailing)");
+        }
+    };
+}
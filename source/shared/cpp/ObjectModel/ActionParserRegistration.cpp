@@ -21,11 +21,16 @@ ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionEle
 }
 
 std::shared_ptr<BaseActionElement> ActionElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    return DeserializeWithIdTracking(*m_parser, context, value);
+}
+
+std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeWithIdTracking(ActionElementParser& parser, ParseContext& context, const Json::Value& value)
 {
     const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
     const AdaptiveCards::InternalId internalId = AdaptiveCards::InternalId::Next();
     context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseActionElement> element = m_parser->Deserialize(context, value);
+    std::shared_ptr<BaseActionElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -36,34 +41,64 @@ std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ActionParserRegistration::ActionParserRegistration()
+namespace
+{
+// Names of the built-in action types, which hosts may not override or remove
+const std::unordered_set<std::string>& s_GetKnownElements()
 {
-    m_knownElements.insert({
+    static const std::unordered_set<std::string> knownElements{
         ActionTypeToString(ActionType::Execute),
         ActionTypeToString(ActionType::OpenUrl),
         ActionTypeToString(ActionType::Popover),
         ActionTypeToString(ActionType::ShowCard),
         ActionTypeToString(ActionType::Submit),
         ActionTypeToString(ActionType::ToggleVisibility),
-        ActionTypeToString(ActionType::UnknownAction),
-    });
-
-    m_cardElementParsers.insert(
-        {{ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
-         {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-         {ActionTypeToString(ActionType::Popover), std::make_shared<PopoverActionParser>()},
-         {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-         {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-         {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-         {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+        ActionTypeToString(ActionType::UnknownAction)};
+    return knownElements;
+}
+
+// Built-in parsers, shared by every ActionParserRegistration until a host changes it
+const std::shared_ptr<const ParserRegistry<ActionElementParser, ActionType>::Table>& s_GetDefaultParsers()
+{
+    static const auto defaultParsers = ParserRegistry<ActionElementParser, ActionType>::MakeTable(
+        EnumHelpers::getActionTypeEnum(),
+        {{ActionType::Execute, std::make_shared<ExecuteActionParser>()},
+         {ActionType::OpenUrl, std::make_shared<OpenUrlActionParser>()},
+         {ActionType::Popover, std::make_shared<PopoverActionParser>()},
+         {ActionType::ShowCard, std::make_shared<ShowCardActionParser>()},
+         {ActionType::Submit, std::make_shared<SubmitActionParser>()},
+         {ActionType::ToggleVisibility, std::make_shared<ToggleVisibilityActionParser>()},
+         {ActionType::UnknownAction, std::make_shared<UnknownActionParser>()}});
+    return defaultParsers;
+}
+} // namespace
+
+ActionParserRegistration::ActionParserRegistration() : m_cardElementParsers(EnumHelpers::getActionTypeEnum(), s_GetDefaultParsers())
+{
+}
+
+const std::shared_ptr<ActionParserRegistration>& ActionParserRegistration::GetDefault()
+{
+    static const std::shared_ptr<ActionParserRegistration> defaultRegistration = []() {
+        auto registration = std::make_shared<ActionParserRegistration>();
+        registration->m_isDefault = true;
+        return registration;
+    }();
+    return defaultRegistration;
 }
 
 void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
 {
+    if (m_isDefault)
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::UnsupportedParserOverride, "The default action parser registration can't be changed");
+    }
+
     // make sure caller isn't attempting to overwrite a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (s_GetKnownElements().find(elementType) == s_GetKnownElements().end())
     {
-        ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+        m_cardElementParsers.Set(elementType, parser);
     }
     else
     {
@@ -74,10 +109,16 @@ void ActionParserRegistration::AddParser(std::string const& elementType, std::sh
 
 void ActionParserRegistration::RemoveParser(std::string const& elementType)
 {
+    if (m_isDefault)
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::UnsupportedParserOverride, "The default action parser registration can't be changed");
+    }
+
     // make sure caller isn't attempting to remove a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (s_GetKnownElements().find(elementType) == s_GetKnownElements().end())
     {
-        ActionParserRegistration::m_cardElementParsers.erase(elementType);
+        m_cardElementParsers.Set(elementType, nullptr);
     }
     else
     {
@@ -88,15 +129,15 @@ void ActionParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ActionParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers.Get(elementType);
+    if (parser != nullptr)
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
         // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
         // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
         // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<ActionElementParser> wrappedParser = std::make_shared<ActionElementParserWrapper>(parser->second);
+        std::shared_ptr<ActionElementParser> wrappedParser = std::make_shared<ActionElementParserWrapper>(parser);
         return wrappedParser;
     }
     else
@@ -104,4 +145,28 @@ std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::st
         return std::shared_ptr<ActionElementParser>(nullptr);
     }
 }
+
+bool ActionParserRegistration::TryDeserialize(ParseContext& context,
+                                              std::string const& elementType,
+                                              const Json::Value& value,
+                                              std::shared_ptr<BaseActionElement>& element) const
+{
+    // Does the same push/pop as the wrapper that GetParser hands out, without creating one
+    bool isBuiltIn;
+    if (ActionElementParser* parser = m_cardElementParsers.Find(elementType, isBuiltIn))
+    {
+        if (isBuiltIn)
+        {
+            element = ActionElementParserWrapper::DeserializeWithIdTracking(*parser, context, value);
+        }
+        else
+        {
+            // Custom parsers may hand JSON of their own to the built-in ones
+            ParseContext::SourceDocumentScope noSourceDocument(context, nullptr);
+            element = ActionElementParserWrapper::DeserializeWithIdTracking(*parser, context, value);
+        }
+        return true;
+    }
+    return false;
+}
 } // namespace AdaptiveCards
@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ParserRegistry.h"
 
 namespace AdaptiveCards
 {
@@ -36,6 +37,9 @@ public:
         return m_parser;
     }
 
+    // Deserializes value with parser, pushing and popping the element's ID state around the call
+    static std::shared_ptr<BaseActionElement> DeserializeWithIdTracking(ActionElementParser& parser, ParseContext& context, const Json::Value& value);
+
 private:
     std::shared_ptr<ActionElementParser> m_parser;
 };
@@ -49,8 +53,20 @@ public:
     void RemoveParser(std::string const& elementType);
     std::shared_ptr<AdaptiveCards::ActionElementParser> GetParser(std::string const& elementType) const;
 
+    // The registration used by a ParseContext that isn't given one. It is shared by the whole process and can't be
+    // changed. To add custom parsers, create a new ActionParserRegistration instead; that is cheap, as it shares the built-in
+    // parsers until it is first changed.
+    static const std::shared_ptr<ActionParserRegistration>& GetDefault();
+
+    // Deserializes value with the parser registered for elementType. Returns false if there is no such parser. Unlike
+    // GetParser, this doesn't allocate a wrapper, and it may be called while other threads add or remove parsers.
+    bool TryDeserialize(ParseContext& context,
+                        std::string const& elementType,
+                        const Json::Value& value,
+                        std::shared_ptr<AdaptiveCards::BaseActionElement>& element) const;
+
 private:
-    std::unordered_set<std::string> m_knownElements;
-    std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+    bool m_isDefault = false;
+    ParserRegistry<AdaptiveCards::ActionElementParser, ActionType> m_cardElementParsers;
 };
 } // namespace AdaptiveCards
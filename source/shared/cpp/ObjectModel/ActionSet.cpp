@@ -64,5 +64,6 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::Actions});
+    m_knownProperties = &knownProperties;
 }
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "AdditionalProperties.h"
+#include "Util.h"
+#include <mutex>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// Copying the properties out is rare, so every element shares one lock for it
+std::mutex& PendingPropertiesMutex()
+{
+    static std::mutex pendingPropertiesMutex;
+    return pendingPropertiesMutex;
+}
+
+bool HasUnknownProperties(const Json::Value& json, const KnownProperties& knownProperties)
+{
+    for (auto it = json.begin(); it != json.end(); ++it)
+    {
+        const char* nameEnd;
+        const char* name = it.memberName(&nameEnd);
+        if (!knownProperties.Contains(std::string_view(name, std::find(name, nameEnd, '\0') - name)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+AdditionalProperties::AdditionalProperties(const AdditionalProperties& other)
+{
+    Assign(other);
+}
+
+AdditionalProperties::AdditionalProperties(AdditionalProperties&& other)
+{
+    Assign(other);
+}
+
+AdditionalProperties& AdditionalProperties::operator=(const AdditionalProperties& other)
+{
+    if (this != &other)
+    {
+        Assign(other);
+    }
+    return *this;
+}
+
+AdditionalProperties& AdditionalProperties::operator=(AdditionalProperties&& other)
+{
+    if (this != &other)
+    {
+        Assign(other);
+    }
+    return *this;
+}
+
+void AdditionalProperties::Assign(const AdditionalProperties& other)
+{
+    if (other.m_isPending.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(PendingPropertiesMutex());
+        if (other.m_isPending.load(std::memory_order_relaxed))
+        {
+            m_values = Json::Value();
+            m_sourceJson = other.m_sourceJson;
+            m_knownProperties = other.m_knownProperties;
+            m_isPending.store(true, std::memory_order_release);
+            return;
+        }
+    }
+
+    m_values = other.m_values;
+    m_sourceJson.reset();
+    m_knownProperties = nullptr;
+    m_isPending.store(false, std::memory_order_release);
+}
+
+void AdditionalProperties::Capture(const Json::Value& json, const KnownProperties& knownProperties, const std::shared_ptr<const Json::Value>& document)
+{
+    if (!document)
+    {
+        Json::Value values;
+        HandleUnknownProperties(json, knownProperties, values);
+        Set(std::move(values));
+    }
+    else if (HasUnknownProperties(json, knownProperties))
+    {
+        m_values = Json::Value();
+        m_sourceJson = std::shared_ptr<const Json::Value>(document, &json);
+        m_knownProperties = &knownProperties;
+        m_isPending.store(true, std::memory_order_release);
+    }
+    else
+    {
+        Set(Json::Value());
+    }
+}
+
+const Json::Value& AdditionalProperties::Get() const
+{
+    if (m_isPending.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(PendingPropertiesMutex());
+        if (m_isPending.load(std::memory_order_relaxed))
+        {
+            HandleUnknownProperties(*m_sourceJson, *m_knownProperties, m_values);
+            m_sourceJson.reset();
+            m_isPending.store(false, std::memory_order_release);
+        }
+    }
+    return m_values;
+}
+
+void AdditionalProperties::Set(Json::Value&& value)
+{
+    m_values = std::move(value);
+    m_sourceJson.reset();
+    m_knownProperties = nullptr;
+    m_isPending.store(false, std::memory_order_release);
+}
+
+void AdditionalProperties::Set(const Json::Value& value)
+{
+    Set(Json::Value(value));
+}
+
+Json::Value AdditionalProperties::ToJson() const
+{
+    if (m_isPending.load(std::memory_order_acquire))
+    {
+        std::unique_lock<std::mutex> lock(PendingPropertiesMutex());
+        if (m_isPending.load(std::memory_order_relaxed))
+        {
+            const auto sourceJson = m_sourceJson;
+            const KnownProperties* knownProperties = m_knownProperties;
+            lock.unlock();
+
+            Json::Value values;
+            HandleUnknownProperties(*sourceJson, *knownProperties, values);
+            return values;
+        }
+    }
+    return m_values;
+}
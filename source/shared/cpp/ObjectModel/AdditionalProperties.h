@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "KnownProperties.h"
+#include <atomic>
+
+namespace AdaptiveCards
+{
+// The properties of an element's JSON that its type doesn't parse itself. They're handed to renderers through
+// GetAdditionalProperties() and written back out by Serialize().
+//
+// Few renderers ever look at them, so when an element is parsed from a document owned by the parse (see
+// ParseContext::GetSourceDocument), it only keeps a reference to its JSON inside the document. The properties are
+// copied out the first time Get() is called, and the reference is dropped then. The document stays alive as long
+// as any element refers to it, which only happens for elements that do have additional properties.
+class AdditionalProperties
+{
+public:
+    AdditionalProperties() = default;
+    AdditionalProperties(const AdditionalProperties& other);
+    AdditionalProperties(AdditionalProperties&& other);
+    AdditionalProperties& operator=(const AdditionalProperties& other);
+    AdditionalProperties& operator=(AdditionalProperties&& other);
+    ~AdditionalProperties() = default;
+
+    // Takes the members of json that aren't in knownProperties. If document is set, json must be part of it.
+    void Capture(const Json::Value& json, const KnownProperties& knownProperties, const std::shared_ptr<const Json::Value>& document);
+
+    // Safe to call from several threads at once
+    const Json::Value& Get() const;
+    void Set(Json::Value&& value);
+    void Set(const Json::Value& value);
+
+    // Returns a copy of the properties, without keeping one if they haven't been copied out yet
+    Json::Value ToJson() const;
+
+private:
+    void Assign(const AdditionalProperties& other);
+
+    mutable Json::Value m_values;
+
+    // Set until the properties are copied out of the element's JSON into m_values. Only changed while holding the
+    // lock in AdditionalProperties.cpp once the element has been handed out.
+    mutable std::atomic<bool> m_isPending{false};
+    mutable std::shared_ptr<const Json::Value> m_sourceJson;
+    const KnownProperties* m_knownProperties = nullptr;
+};
+} // namespace AdaptiveCards
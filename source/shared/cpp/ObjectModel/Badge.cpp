@@ -174,14 +174,16 @@ std::shared_ptr<BaseCardElement> BadgeParser::DeserializeFromString(ParseContext
 
 void Badge::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-            {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Appearance),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Icon),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconPosition),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Appearance),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Shape),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Appearance,
+         AdaptiveCardSchemaKey::Icon,
+         AdaptiveCardSchemaKey::IconPosition,
+         AdaptiveCardSchemaKey::Appearance,
+         AdaptiveCardSchemaKey::Shape,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Text});
+    m_knownProperties = &knownProperties;
 }
 
@@ -185,14 +185,16 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ActionRole)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::IconUrl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Mode,
+         AdaptiveCardSchemaKey::Tooltip,
+         AdaptiveCardSchemaKey::IsEnabled,
+         AdaptiveCardSchemaKey::ActionRole});
+    m_knownProperties = &knownProperties;
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -10,6 +10,7 @@
 #include "ThemedUrl.h"
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+void HandleUnknownProperties(const Json::Value& json, const AdaptiveCards::KnownProperties& knownProperties, Json::Value& unknownProperties);
 
 namespace AdaptiveCards
 {
@@ -141,12 +142,12 @@ private:
 template <typename T>
 std::shared_ptr<T> BaseActionElement::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> cardElement = std::make_shared<T>();
+    std::shared_ptr<T> cardElement = context.MakeShared<T>();
     std::shared_ptr<BaseActionElement> baseActionElement = std::static_pointer_cast<BaseActionElement>(cardElement);
     DeserializeBaseProperties(context, json, baseActionElement);
 
-    // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
+    // Keep any properties that the element type doesn't know as additional properties
+    baseActionElement->m_additionalProperties.Capture(json, *baseActionElement->m_knownProperties, context.GetSourceDocument());
 
     return cardElement;
 }
@@ -27,13 +27,15 @@ BaseCardElement::BaseCardElement(CardElementType type) :
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetWidth),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::IsVisible,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::TargetWidth,
+         AdaptiveCardSchemaKey::Separator,
+         AdaptiveCardSchemaKey::Spacing});
+    m_knownProperties = &knownProperties;
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -160,14 +162,13 @@ Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseAct
 void BaseCardElement::ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element)
 {
     const std::string typeString = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->GetParser(typeString);
+    std::shared_ptr<BaseCardElement> parsedElement;
 
-    if (parser == nullptr)
+    if (!context.elementParserRegistration->TryDeserialize(context, typeString, json, parsedElement))
     {
-        parser = context.elementParserRegistration->GetParser("Unknown");
+        context.elementParserRegistration->TryDeserialize(context, CardElementTypeToString(CardElementType::Unknown), json, parsedElement);
     }
 
-    auto parsedElement = parser->Deserialize(context, json);
     if (parsedElement != nullptr)
     {
         element = std::move(parsedElement);
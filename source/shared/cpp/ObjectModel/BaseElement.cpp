@@ -8,7 +8,10 @@
 
 namespace AdaptiveCards
 {
-unsigned int InternalId::s_currentInternalId = 1;
+std::atomic<unsigned int> InternalId::s_nextInternalIdBlock{2};
+thread_local unsigned int InternalId::s_currentInternalId = 1;
+thread_local unsigned int InternalId::s_nextInternalId = 0;
+thread_local unsigned int InternalId::s_internalIdBlockEnd = 0;
 
 InternalId InternalId::Current()
 {
@@ -18,13 +21,16 @@ InternalId InternalId::Current()
 
 InternalId InternalId::Next()
 {
-    s_currentInternalId++;
-
-    // handle overflow case
-    if (s_currentInternalId == InternalId::Invalid)
+    do
     {
-        s_currentInternalId++;
-    }
+        if (s_nextInternalId == s_internalIdBlockEnd)
+        {
+            s_nextInternalId = s_nextInternalIdBlock.fetch_add(InternalIdBlockSize, std::memory_order_relaxed);
+            s_internalIdBlockEnd = s_nextInternalId + InternalIdBlockSize;
+        }
+
+        s_currentInternalId = s_nextInternalId++;
+    } while (s_currentInternalId == InternalId::Invalid); // handle overflow case
 
     return Current();
 }
@@ -72,25 +78,27 @@ void BaseElement::SetElementTypeString(const std::string& value)
 
 void BaseElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const KnownProperties knownProperties(
+        nullptr,
+        {AdaptiveCardSchemaKey::Fallback,
+         AdaptiveCardSchemaKey::Id,
+         AdaptiveCardSchemaKey::Requires,
+         AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
 
 const Json::Value& BaseElement::GetAdditionalProperties() const
 {
-    return m_additionalProperties;
+    return m_additionalProperties.Get();
 }
 
 void BaseElement::SetAdditionalProperties(Json::Value&& value)
 {
-    m_additionalProperties = std::move(value);
+    m_additionalProperties.Set(std::move(value));
 }
 void BaseElement::SetAdditionalProperties(const Json::Value& value)
 {
-    m_additionalProperties = value;
+    m_additionalProperties.Set(value);
 }
 
 // Given a map of what our host provides, determine if this element's requirements are satisfied.
@@ -98,25 +106,11 @@ bool BaseElement::MeetsRequirements(const AdaptiveCards::FeatureRegistration& fe
 {
     for (const auto& requirement : m_requires)
     {
-        // special case for adaptive cards version
-        const auto& requirementName = requirement.first;
-        const auto& requirementVersion = requirement.second;
-        const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
-        if (featureVersion.empty())
+        // the host must provide the feature, at the required version or later
+        if (!featureRegistration.SupportsFeature(requirement.first, requirement.second))
         {
-            // host doesn't provide this requirement
             return false;
         }
-        else
-        {
-            // host provides this requirement, but does it provide an acceptible version?
-            const SemanticVersion providesVersion{featureVersion};
-            if (providesVersion < requirementVersion)
-            {
-                // host's provided version is too low
-                return false;
-            }
-        }
     }
 
     return true;
@@ -134,8 +128,7 @@ const std::unordered_map<std::string, AdaptiveCards::SemanticVersion>& BaseEleme
 
 Json::Value BaseElement::SerializeToJsonValue() const
 {
-    Json::Value root = GetAdditionalProperties(); // Create a copy of the additional properties by assigning the
-                                                  // return value to a value, rather than reference, type
+    Json::Value root = m_additionalProperties.ToJson();
 
     // Important -- we're explicitly getting the type as a string here because that's where we store the type that
     // was specified by the card author.
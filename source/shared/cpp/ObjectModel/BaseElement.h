@@ -4,7 +4,9 @@
 
 #include "pch.h"
 #include "json/json.h"
+#include "AdditionalProperties.h"
 #include "InternalId.h"
+#include "KnownProperties.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
@@ -103,8 +105,8 @@ protected:
     }
 
     std::string m_typeString;
-    std::unordered_set<std::string> m_knownProperties;
-    Json::Value m_additionalProperties;
+    const KnownProperties* m_knownProperties;
+    AdditionalProperties m_additionalProperties;
 
 private:
     void PopulateKnownPropertiesSet();
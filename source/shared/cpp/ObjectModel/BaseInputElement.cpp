@@ -87,10 +87,12 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
 
 void BaseInputElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::IsRequired,
+         AdaptiveCardSchemaKey::ErrorMessage,
+         AdaptiveCardSchemaKey::Label});
+    m_knownProperties = &knownProperties;
 }
 
 std::shared_ptr<BaseInputElement> BaseInputElement::DeserializeBasePropertiesFromString(ParseContext& context, const std::string& jsonString)
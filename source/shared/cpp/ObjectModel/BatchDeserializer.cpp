@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "BatchDeserializer.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+BatchDeserializer::BatchDeserializer(std::shared_ptr<ParseThreadPool> threadPool) :
+    BatchDeserializer(std::move(threadPool), nullptr, nullptr)
+{
+}
+
+BatchDeserializer::BatchDeserializer(std::shared_ptr<ParseThreadPool> threadPool,
+                                     std::shared_ptr<ElementParserRegistration> elementRegistration,
+                                     std::shared_ptr<ActionParserRegistration> actionRegistration) :
+    m_threadPool(threadPool ? std::move(threadPool) : std::make_shared<ParseThreadPool>(1)),
+    m_elementParserRegistration(elementRegistration ? std::move(elementRegistration) : ElementParserRegistration::GetDefault()),
+    m_actionParserRegistration(actionRegistration ? std::move(actionRegistration) : ActionParserRegistration::GetDefault())
+{
+}
+
+std::vector<BatchDeserializer::Result> BatchDeserializer::DeserializeFromBuffers(
+    const JsonBuffer* buffers, size_t count, const std::string& rendererVersion) const
+{
+    std::vector<Result> results(count);
+
+    m_threadPool->RunParallel(count, [&](size_t i) {
+        Result& result = results[i];
+        try
+        {
+            ParseContext context(m_elementParserRegistration, m_actionParserRegistration);
+            result.parseResult = AdaptiveCard::DeserializeFromBuffer(buffers[i].data, buffers[i].length, rendererVersion, context);
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            result.error = std::make_shared<AdaptiveCardParseException>(e);
+        }
+        catch (const std::exception& e)
+        {
+            // Anything else that a parse can throw, such as a JSON value of an unexpected type
+            result.error = std::make_shared<AdaptiveCardParseException>(ErrorStatusCode::CustomError, e.what());
+        }
+    });
+
+    return results;
+}
+
+std::vector<BatchDeserializer::Result> BatchDeserializer::DeserializeFromStrings(
+    const std::vector<std::string>& jsonStrings, const std::string& rendererVersion) const
+{
+    std::vector<JsonBuffer> buffers;
+    buffers.reserve(jsonStrings.size());
+    for (const auto& jsonString : jsonStrings)
+    {
+        buffers.push_back({jsonString.data(), jsonString.size()});
+    }
+    return DeserializeFromBuffers(buffers.data(), buffers.size(), rendererVersion);
+}
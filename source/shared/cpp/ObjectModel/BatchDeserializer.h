@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "AdaptiveCardParseException.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "ParseThreadPool.h"
+
+namespace AdaptiveCards
+{
+// Parses many independent cards at once on a ParseThreadPool, for hosts that validate or normalize cards in bulk.
+//
+// Threads pick up the next unparsed card as soon as they finish one, so a few large cards don't hold up the rest of
+// the batch. Every card is parsed with its own ParseContext, as AdaptiveCard::DeserializeFromString would, but the
+// contexts share this object's parser registrations rather than building new ones for each card. Registered parsers
+// must therefore be safe to call from several threads at once.
+class BatchDeserializer
+{
+public:
+    // One card's JSON, owned by the caller. It doesn't need to be null terminated and is not copied.
+    struct JsonBuffer
+    {
+        const char* data;
+        size_t length;
+    };
+
+    // Outcome of parsing one card: the parse result, or the exception that a serial parse of the card would have
+    // thrown. Exactly one of the two is set.
+    struct Result
+    {
+        std::shared_ptr<ParseResult> parseResult;
+        std::shared_ptr<AdaptiveCardParseException> error;
+    };
+
+    explicit BatchDeserializer(std::shared_ptr<ParseThreadPool> threadPool);
+    BatchDeserializer(std::shared_ptr<ParseThreadPool> threadPool,
+                      std::shared_ptr<ElementParserRegistration> elementRegistration,
+                      std::shared_ptr<ActionParserRegistration> actionRegistration);
+
+    // Returns one result per card, in the order given. A card that fails to parse doesn't affect the others, and
+    // nothing is thrown across the batch.
+    std::vector<Result> DeserializeFromBuffers(const JsonBuffer* buffers, size_t count, const std::string& rendererVersion) const;
+    std::vector<Result> DeserializeFromStrings(const std::vector<std::string>& jsonStrings, const std::string& rendererVersion) const;
+
+private:
+    const std::shared_ptr<ParseThreadPool> m_threadPool;
+    const std::shared_ptr<ElementParserRegistration> m_elementParserRegistration;
+    const std::shared_ptr<ActionParserRegistration> m_actionParserRegistration;
+};
+} // namespace AdaptiveCards
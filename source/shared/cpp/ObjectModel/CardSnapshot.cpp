@@ -0,0 +1,313 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardSnapshot.h"
+#include "AdaptiveCardParseException.h"
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr char c_magic[] = {'A', 'C', 'S', 'N'};
+
+// Bump whenever the encoding changes. Older snapshots are then rejected rather than misread.
+constexpr unsigned char c_formatVersion = 1;
+
+// Same nesting limit as the JSON reader
+constexpr unsigned int c_maxDepth = 1000;
+
+enum class ValueTag : unsigned char
+{
+    Null = 0,
+    False,
+    True,
+    Int,
+    UInt,
+    Double,
+    String,
+    Array,
+    Object,
+};
+
+void WriteVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+class SnapshotWriter
+{
+public:
+    std::string Write(const Json::Value& cardJson)
+    {
+        WriteValue(cardJson);
+
+        std::string snapshot(c_magic, sizeof(c_magic));
+        snapshot.push_back(static_cast<char>(c_formatVersion));
+
+        WriteVarint(snapshot, m_strings.size());
+        for (const std::string* string : m_strings)
+        {
+            WriteVarint(snapshot, string->size());
+            snapshot.append(*string);
+        }
+
+        snapshot.append(m_values);
+        return snapshot;
+    }
+
+private:
+    void WriteTag(ValueTag tag) { m_values.push_back(static_cast<char>(tag)); }
+
+    void WriteString(const std::string& string)
+    {
+        // Strings are numbered in the order they are first seen, which is also the order the reader meets them
+        const auto inserted = m_stringIndexes.emplace(string, m_strings.size());
+        if (inserted.second)
+        {
+            m_strings.push_back(&inserted.first->first);
+        }
+        WriteVarint(m_values, inserted.first->second);
+    }
+
+    void WriteValue(const Json::Value& value)
+    {
+        switch (value.type())
+        {
+        case Json::nullValue:
+            WriteTag(ValueTag::Null);
+            break;
+        case Json::booleanValue:
+            WriteTag(value.asBool() ? ValueTag::True : ValueTag::False);
+            break;
+        case Json::intValue:
+        {
+            const int64_t intValue = value.asInt64();
+            WriteTag(ValueTag::Int);
+            WriteVarint(m_values, (static_cast<uint64_t>(intValue) << 1) ^ static_cast<uint64_t>(intValue >> 63));
+            break;
+        }
+        case Json::uintValue:
+            WriteTag(ValueTag::UInt);
+            WriteVarint(m_values, value.asUInt64());
+            break;
+        case Json::realValue:
+        {
+            const double doubleValue = value.asDouble();
+            uint64_t bits;
+            std::memcpy(&bits, &doubleValue, sizeof(bits));
+
+            WriteTag(ValueTag::Double);
+            for (unsigned int i = 0; i < sizeof(bits); ++i)
+            {
+                m_values.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+            }
+            break;
+        }
+        case Json::stringValue:
+            WriteTag(ValueTag::String);
+            WriteString(value.asString());
+            break;
+        case Json::arrayValue:
+            WriteTag(ValueTag::Array);
+            WriteVarint(m_values, value.size());
+            for (const auto& element : value)
+            {
+                WriteValue(element);
+            }
+            break;
+        case Json::objectValue:
+            WriteTag(ValueTag::Object);
+            WriteVarint(m_values, value.size());
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                WriteString(it.name());
+                WriteValue(*it);
+            }
+            break;
+        }
+    }
+
+    std::unordered_map<std::string, size_t> m_stringIndexes;
+    std::vector<const std::string*> m_strings;
+    std::string m_values;
+};
+
+class SnapshotReader
+{
+public:
+    SnapshotReader(const char* data, size_t length) : m_current(data), m_end(data + length) {}
+
+    Json::Value Read()
+    {
+        if (static_cast<size_t>(m_end - m_current) < sizeof(c_magic) + 1 || !std::equal(c_magic, c_magic + sizeof(c_magic), m_current))
+        {
+            ThrowInvalidSnapshot("not a card snapshot");
+        }
+        m_current += sizeof(c_magic);
+
+        if (ReadByte() != c_formatVersion)
+        {
+            ThrowInvalidSnapshot("unsupported format version");
+        }
+
+        const size_t stringCount = ReadCount();
+        m_strings.reserve(stringCount);
+        for (size_t i = 0; i < stringCount; ++i)
+        {
+            const size_t stringLength = ReadCount();
+            m_strings.emplace_back(m_current, stringLength);
+            m_current += stringLength;
+        }
+
+        Json::Value cardJson;
+        ReadValue(cardJson, 0);
+        if (m_current != m_end)
+        {
+            ThrowInvalidSnapshot("unexpected data after the card");
+        }
+        return cardJson;
+    }
+
+private:
+    [[noreturn]] static void ThrowInvalidSnapshot(const std::string& reason)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Invalid card snapshot: " + reason);
+    }
+
+    unsigned char ReadByte()
+    {
+        if (m_current == m_end)
+        {
+            ThrowInvalidSnapshot("unexpected end of data");
+        }
+        return static_cast<unsigned char>(*m_current++);
+    }
+
+    uint64_t ReadVarint()
+    {
+        uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            const unsigned char byte = ReadByte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        ThrowInvalidSnapshot("malformed integer");
+    }
+
+    // Every element, member and string byte takes at least one byte of input, so a count larger than what is left
+    // can only come from corrupt data. Checking it up front keeps a bad count from turning into a huge allocation.
+    size_t ReadCount()
+    {
+        const uint64_t count = ReadVarint();
+        if (count > static_cast<uint64_t>(m_end - m_current))
+        {
+            ThrowInvalidSnapshot("unexpected end of data");
+        }
+        return static_cast<size_t>(count);
+    }
+
+    const std::string& ReadString()
+    {
+        const uint64_t index = ReadVarint();
+        if (index >= m_strings.size())
+        {
+            ThrowInvalidSnapshot("string index out of range");
+        }
+        return m_strings[static_cast<size_t>(index)];
+    }
+
+    void ReadValue(Json::Value& value, unsigned int depth)
+    {
+        if (depth > c_maxDepth)
+        {
+            ThrowInvalidSnapshot("nesting too deep");
+        }
+
+        switch (static_cast<ValueTag>(ReadByte()))
+        {
+        case ValueTag::Null:
+            value = Json::Value();
+            break;
+        case ValueTag::False:
+            value = false;
+            break;
+        case ValueTag::True:
+            value = true;
+            break;
+        case ValueTag::Int:
+        {
+            const uint64_t zigzag = ReadVarint();
+            value = static_cast<Json::Int64>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+            break;
+        }
+        case ValueTag::UInt:
+            value = static_cast<Json::UInt64>(ReadVarint());
+            break;
+        case ValueTag::Double:
+        {
+            uint64_t bits = 0;
+            for (unsigned int i = 0; i < sizeof(bits); ++i)
+            {
+                bits |= static_cast<uint64_t>(ReadByte()) << (8 * i);
+            }
+
+            double doubleValue;
+            std::memcpy(&doubleValue, &bits, sizeof(doubleValue));
+            value = doubleValue;
+            break;
+        }
+        case ValueTag::String:
+            value = ReadString();
+            break;
+        case ValueTag::Array:
+        {
+            const size_t count = ReadCount();
+            value = Json::Value(Json::arrayValue);
+            value.resize(static_cast<Json::ArrayIndex>(count));
+            for (Json::ArrayIndex i = 0; i < count; ++i)
+            {
+                ReadValue(value[i], depth + 1);
+            }
+            break;
+        }
+        case ValueTag::Object:
+        {
+            const size_t count = ReadCount();
+            value = Json::Value(Json::objectValue);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string& key = ReadString();
+                ReadValue(value[key], depth + 1);
+            }
+            break;
+        }
+        default:
+            ThrowInvalidSnapshot("unknown value type");
+        }
+    }
+
+    const char* m_current;
+    const char* const m_end;
+    std::vector<std::string> m_strings;
+};
+} // namespace
+
+std::string CardSnapshot::Write(const Json::Value& cardJson)
+{
+    return SnapshotWriter().Write(cardJson);
+}
+
+Json::Value CardSnapshot::Read(const char* data, size_t length)
+{
+    return SnapshotReader(data, length).Read();
+}
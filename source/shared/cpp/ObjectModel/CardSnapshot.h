@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Compact, versioned binary encoding of a parsed card, used by AdaptiveCard::SerializeToSnapshot and
+// AdaptiveCard::DeserializeFromSnapshot.
+//
+// A snapshot holds the card exactly as AdaptiveCard::SerializeToJsonValue describes it, so every element, action,
+// fallback, requires and additional property the object model knows how to serialize is captured. The encoding is
+// a header, a table of the distinct strings in the card and then the value tree in prefix order, where every string
+// and object key is an index into the table. Reading a snapshot is a single forward pass with no tokenizing, escape
+// decoding or number parsing, and the repeated property names and type names of a card are only stored once.
+//
+//   header   "ACSN" magic, format version (u8)
+//   strings  count, then (length, bytes) for each string
+//   value    tag (u8) followed by its payload:
+//              null, false, true    no payload
+//              int, uint            zigzag / plain varint
+//              double               8 bytes, little endian IEEE 754
+//              string               string index
+//              array                count, then the elements
+//              object               count, then (key string index, value) for each member
+//
+// All counts, lengths and indexes are unsigned LEB128 varints. Snapshots are meant to be cached by the host and are
+// only read back by the same format version; anything else is rejected so that the host can re-parse the JSON.
+class CardSnapshot
+{
+public:
+    static std::string Write(const Json::Value& cardJson);
+
+    // Throws AdaptiveCardParseException if the data is not a snapshot of this format version or is truncated
+    static Json::Value Read(const char* data, size_t length);
+};
+} // namespace AdaptiveCards
@@ -79,7 +79,7 @@ std::shared_ptr<BaseCardElement> CarouselParser::DeserializeWithoutCheckingType(
 
 void Carousel::DeserializeChildren(ParseContext& context, const Json::Value& value)
 {
-    auto elementArray = ParseUtil::GetArray(value, AdaptiveCardSchemaKey::Pages, false);
+    const auto& elementArray = ParseUtil::GetArray(value, AdaptiveCardSchemaKey::Pages, false);
 
     std::vector<std::shared_ptr<CarouselPage>> elements;
     if (elementArray.empty())
@@ -102,10 +102,11 @@ void Carousel::DeserializeChildren(ParseContext& context, const Json::Value& val
 
 void Carousel::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::PageAnimation),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::CarouselPage)
-    });
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::PageAnimation,
+         AdaptiveCardSchemaKey::CarouselPage});
+    m_knownProperties = &knownProperties;
 }
 
 void Carousel::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
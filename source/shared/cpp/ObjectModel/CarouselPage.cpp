@@ -136,9 +136,11 @@ void CarouselPage::DeserializeChildren(ParseContext& context, const Json::Value&
 
 void CarouselPage::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-            {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Layouts)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Items,
+         AdaptiveCardSchemaKey::Layouts});
+    m_knownProperties = &knownProperties;
 }
 
 void CarouselPage::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
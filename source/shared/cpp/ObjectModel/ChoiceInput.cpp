@@ -11,9 +11,9 @@ ChoiceInput::ChoiceInput()
 {
 }
 
-std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& /*context*/, const Json::Value& json)
+std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto choice = std::make_shared<ChoiceInput>();
+    auto choice = context.MakeShared<ChoiceInput>();
 
     choice->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
     choice->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true));
@@ -162,12 +162,14 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(Par
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ChoicesData),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Choices,
+         AdaptiveCardSchemaKey::ChoicesData,
+         AdaptiveCardSchemaKey::IsMultiSelect,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
@@ -11,8 +11,17 @@ CitationRun::CitationRun() :
     PopulateKnownPropertiesSet();
 }
 
-void CitationRun::PopulateKnownPropertiesSet() {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+void CitationRun::PopulateKnownPropertiesSet()
+{
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {},
+        [this]() {
+            std::unordered_set<std::string> textElementProperties;
+            m_textElementProperties->PopulateKnownPropertiesSet(textElementProperties);
+            return textElementProperties;
+        }());
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value CitationRun::SerializeToJsonValue() const {
@@ -42,7 +51,7 @@ std::shared_ptr<Inline> CitationRun::Deserialize(ParseContext& context, const Js
 
     inlineCitationRun->m_textElementProperties->Deserialize(context, json);
     inlineCitationRun->m_referenceIndex = ParseUtil::GetInt(json, AdaptiveCardSchemaKey::ReferenceIndex, 1, true);
-    HandleUnknownProperties(json, inlineCitationRun->m_knownProperties, inlineCitationRun->m_additionalProperties);
+    inlineCitationRun->m_additionalProperties.Capture(json, *inlineCitationRun->m_knownProperties, context.GetSourceDocument());
 
     return inlineCitationRun;
 }
@@ -112,13 +112,15 @@ Json::Value Column::SerializeToJsonValue() const
 
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Items,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Width,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -52,11 +52,13 @@ void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& va
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
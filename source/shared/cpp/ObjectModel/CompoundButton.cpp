@@ -127,10 +127,12 @@ std::shared_ptr<BaseCardElement> CompoundButtonParser::DeserializeWithoutCheckin
 
 void CompoundButton::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-            {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Badge),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Description),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Icon),
-             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Badge,
+         AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Description,
+         AdaptiveCardSchemaKey::Icon,
+         AdaptiveCardSchemaKey::SelectAction});
+    m_knownProperties = &knownProperties;
 }
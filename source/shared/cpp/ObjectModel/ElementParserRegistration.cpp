@@ -37,12 +37,17 @@ BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseC
 }
 
 std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    return DeserializeWithIdTracking(*m_parser, context, value);
+}
+
+std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeWithIdTracking(BaseCardElementParser& parser, ParseContext& context, const Json::Value& value)
 {
     const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
     const InternalId internalId = InternalId::Next();
 
     context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseCardElement> element = m_parser->Deserialize(context, value);
+    std::shared_ptr<BaseCardElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -53,71 +58,102 @@ std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ElementParserRegistration::ElementParserRegistration()
+namespace
+{
+// Names of the built-in element types, which hosts may not override or remove
+const std::unordered_set<std::string>& s_GetKnownElements()
+{
+    static const std::unordered_set<std::string> knownElements{
+        CardElementTypeToString(CardElementType::ActionSet),
+        CardElementTypeToString(CardElementType::Badge),
+        CardElementTypeToString(CardElementType::ChoiceSetInput),
+        CardElementTypeToString(CardElementType::Column),
+        CardElementTypeToString(CardElementType::ColumnSet),
+        CardElementTypeToString(CardElementType::CompoundButton),
+        CardElementTypeToString(CardElementType::Container),
+        CardElementTypeToString(CardElementType::DateInput),
+        CardElementTypeToString(CardElementType::FactSet),
+        CardElementTypeToString(CardElementType::Image),
+        CardElementTypeToString(CardElementType::Icon),
+        CardElementTypeToString(CardElementType::ImageSet),
+        CardElementTypeToString(CardElementType::Media),
+        CardElementTypeToString(CardElementType::NumberInput),
+        CardElementTypeToString(CardElementType::ProgressBar),
+        CardElementTypeToString(CardElementType::ProgressRing),
+        CardElementTypeToString(CardElementType::RatingInput),
+        CardElementTypeToString(CardElementType::RatingLabel),
+        CardElementTypeToString(CardElementType::RichTextBlock),
+        CardElementTypeToString(CardElementType::Table),
+        CardElementTypeToString(CardElementType::TextBlock),
+        CardElementTypeToString(CardElementType::TextInput),
+        CardElementTypeToString(CardElementType::TimeInput),
+        CardElementTypeToString(CardElementType::ToggleInput),
+        CardElementTypeToString(CardElementType::Carousel),
+        CardElementTypeToString(CardElementType::Unknown)};
+    return knownElements;
+}
+
+// Built-in parsers, shared by every ElementParserRegistration until a host changes it
+const std::shared_ptr<const ParserRegistry<BaseCardElementParser, CardElementType>::Table>& s_GetDefaultParsers()
+{
+    static const auto defaultParsers = ParserRegistry<BaseCardElementParser, CardElementType>::MakeTable(
+        EnumHelpers::getCardElementTypeEnum(),
+        {{CardElementType::ActionSet, std::make_shared<ActionSetParser>()},
+         {CardElementType::Badge, std::make_shared<BadgeParser>()},
+         {CardElementType::ChoiceSetInput, std::make_shared<ChoiceSetInputParser>()},
+         {CardElementType::Column, std::make_shared<ColumnParser>()},
+         {CardElementType::ColumnSet, std::make_shared<ColumnSetParser>()},
+         {CardElementType::Container, std::make_shared<ContainerParser>()},
+         {CardElementType::DateInput, std::make_shared<DateInputParser>()},
+         {CardElementType::FactSet, std::make_shared<FactSetParser>()},
+         {CardElementType::Image, std::make_shared<ImageParser>()},
+         {CardElementType::Icon, std::make_shared<IconParser>()},
+         {CardElementType::ImageSet, std::make_shared<ImageSetParser>()},
+         {CardElementType::Media, std::make_shared<MediaParser>()},
+         {CardElementType::NumberInput, std::make_shared<NumberInputParser>()},
+         {CardElementType::ProgressBar, std::make_shared<ProgressBarParser>()},
+         {CardElementType::ProgressRing, std::make_shared<ProgressRingParser>()},
+         {CardElementType::RatingInput, std::make_shared<RatingInputParser>()},
+         {CardElementType::RatingLabel, std::make_shared<RatingLabelParser>()},
+         {CardElementType::RichTextBlock, std::make_shared<RichTextBlockParser>()},
+         {CardElementType::Table, std::make_shared<TableParser>()},
+         {CardElementType::TextBlock, std::make_shared<TextBlockParser>()},
+         {CardElementType::TextInput, std::make_shared<TextInputParser>()},
+         {CardElementType::TimeInput, std::make_shared<TimeInputParser>()},
+         {CardElementType::ToggleInput, std::make_shared<ToggleInputParser>()},
+         {CardElementType::CompoundButton, std::make_shared<CompoundButtonParser>()},
+         {CardElementType::Carousel, std::make_shared<CarouselParser>()},
+         {CardElementType::CarouselPage, std::make_shared<CarouselPageParser>()},
+         {CardElementType::Unknown, std::make_shared<UnknownElementParser>()}});
+    return defaultParsers;
+}
+} // namespace
+
+ElementParserRegistration::ElementParserRegistration() : m_cardElementParsers(EnumHelpers::getCardElementTypeEnum(), s_GetDefaultParsers())
+{
+}
+
+const std::shared_ptr<ElementParserRegistration>& ElementParserRegistration::GetDefault()
 {
-    m_knownElements.insert(
-                           {CardElementTypeToString(CardElementType::ActionSet),
-                               CardElementTypeToString(CardElementType::Badge),
-                               CardElementTypeToString(CardElementType::ChoiceSetInput),
-                               CardElementTypeToString(CardElementType::Column),
-                               CardElementTypeToString(CardElementType::ColumnSet),
-                               CardElementTypeToString(CardElementType::CompoundButton),
-                               CardElementTypeToString(CardElementType::Container),
-                               CardElementTypeToString(CardElementType::DateInput),
-                               CardElementTypeToString(CardElementType::FactSet),
-                               CardElementTypeToString(CardElementType::Image),
-                               CardElementTypeToString(CardElementType::Icon),
-                               CardElementTypeToString(CardElementType::ImageSet),
-                               CardElementTypeToString(CardElementType::Media),
-                               CardElementTypeToString(CardElementType::NumberInput),
-                               CardElementTypeToString(CardElementType::ProgressBar),
-                               CardElementTypeToString(CardElementType::ProgressRing),
-                               CardElementTypeToString(CardElementType::RatingInput),
-                               CardElementTypeToString(CardElementType::RatingLabel),
-                               CardElementTypeToString(CardElementType::RichTextBlock),
-                               CardElementTypeToString(CardElementType::Table),
-                               CardElementTypeToString(CardElementType::TextBlock),
-                               CardElementTypeToString(CardElementType::TextInput),
-                               CardElementTypeToString(CardElementType::TimeInput),
-                               CardElementTypeToString(CardElementType::ToggleInput),
-                               CardElementTypeToString(CardElementType::Carousel),
-                               CardElementTypeToString(CardElementType::Unknown)});
-
-    m_cardElementParsers.insert(
-        {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-         {CardElementTypeToString(CardElementType::Badge), std::make_shared<BadgeParser>()},
-         {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-         {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-         {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-         {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-         {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-         {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-         {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-         {CardElementTypeToString(CardElementType::Icon), std::make_shared<IconParser>()},
-         {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-         {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-         {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-         {CardElementTypeToString(CardElementType::ProgressBar), std::make_shared<ProgressBarParser>()},
-         {CardElementTypeToString(CardElementType::ProgressRing), std::make_shared<ProgressRingParser>()},
-         {CardElementTypeToString(CardElementType::RatingInput), std::make_shared<RatingInputParser>()},
-         {CardElementTypeToString(CardElementType::RatingLabel), std::make_shared<RatingLabelParser>()},
-         {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-         {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
-         {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-         {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-         {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-         {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-         {CardElementTypeToString(CardElementType::CompoundButton), std::make_shared<CompoundButtonParser>()},
-         {CardElementTypeToString(CardElementType::Carousel), std::make_shared<CarouselParser>()},
-         {CardElementTypeToString(CardElementType::CarouselPage), std::make_shared<CarouselPageParser>()},
-         {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    static const std::shared_ptr<ElementParserRegistration> defaultRegistration = []() {
+        auto registration = std::make_shared<ElementParserRegistration>();
+        registration->m_isDefault = true;
+        return registration;
+    }();
+    return defaultRegistration;
 }
 
 void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (m_isDefault)
     {
-        ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::UnsupportedParserOverride, "The default element parser registration can't be changed");
+    }
+
+    if (s_GetKnownElements().find(elementType) == s_GetKnownElements().end())
+    {
+        m_cardElementParsers.Set(elementType, parser);
     }
     else
     {
@@ -128,9 +164,15 @@ void ElementParserRegistration::AddParser(std::string const& elementType, std::s
 
 void ElementParserRegistration::RemoveParser(std::string const& elementType)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (m_isDefault)
     {
-        ElementParserRegistration::m_cardElementParsers.erase(elementType);
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::UnsupportedParserOverride, "The default element parser registration can't be changed");
+    }
+
+    if (s_GetKnownElements().find(elementType) == s_GetKnownElements().end())
+    {
+        m_cardElementParsers.Set(elementType, nullptr);
     }
     else
     {
@@ -141,15 +183,15 @@ void ElementParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ElementParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers.Get(elementType);
+    if (parser != nullptr)
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
         // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
         // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
         // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<BaseCardElementParser> wrappedParser = std::make_shared<BaseCardElementParserWrapper>(parser->second);
+        std::shared_ptr<BaseCardElementParser> wrappedParser = std::make_shared<BaseCardElementParserWrapper>(parser);
         return wrappedParser;
     }
     else
@@ -157,4 +199,28 @@ std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std:
         return std::shared_ptr<BaseCardElementParser>(nullptr);
     }
 }
+
+bool ElementParserRegistration::TryDeserialize(ParseContext& context,
+                                               std::string const& elementType,
+                                               const Json::Value& value,
+                                               std::shared_ptr<BaseCardElement>& element) const
+{
+    // Does the same push/pop as the wrapper that GetParser hands out, without creating one
+    bool isBuiltIn;
+    if (BaseCardElementParser* parser = m_cardElementParsers.Find(elementType, isBuiltIn))
+    {
+        if (isBuiltIn)
+        {
+            element = BaseCardElementParserWrapper::DeserializeWithIdTracking(*parser, context, value);
+        }
+        else
+        {
+            // Custom parsers may hand JSON of their own to the built-in ones
+            ParseContext::SourceDocumentScope noSourceDocument(context, nullptr);
+            element = BaseCardElementParserWrapper::DeserializeWithIdTracking(*parser, context, value);
+        }
+        return true;
+    }
+    return false;
+}
 } // namespace AdaptiveCards
@@ -2,6 +2,10 @@
 // Licensed under the MIT License.
 #pragma once
 #include "pch.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
 
 namespace AdaptiveCards
 {
@@ -16,13 +20,47 @@ struct CaseInsensitiveEqualTo
     }
 };
 
+namespace EnumHelpers
+{
+    constexpr char ToLowerAscii(char c) noexcept
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // FNV-1a over the lower-cased characters of str
+    constexpr std::uint64_t CaseInsensitiveFnv1a(std::string_view str) noexcept
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < str.size(); ++i)
+        {
+            hash = (hash ^ static_cast<unsigned char>(ToLowerAscii(str[i]))) * 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    constexpr bool CaseInsensitiveEquals(std::string_view lhs, std::string_view rhs) noexcept
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (ToLowerAscii(lhs[i]) != ToLowerAscii(rhs[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace EnumHelpers
+
 struct CaseInsensitiveHash
 {
     template <typename T>
     size_t operator()(T const& keyval) const noexcept
     {
-        return std::accumulate(
-            std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) { return acc + std::toupper(c); });
+        return static_cast<size_t>(EnumHelpers::CaseInsensitiveFnv1a(keyval));
     }
 };
 
@@ -37,46 +75,328 @@ struct EnumHash
 
 namespace EnumHelpers
 {
-    // Manage mapping T<->std::string using two internal unordered_maps.
     template <typename T>
-    class EnumMapping
+    struct EnumName
+    {
+        T value{};
+        std::string_view name{};
+    };
+
+    template <typename T>
+    struct EnumAlias
+    {
+        std::string_view name{};
+        T value{};
+    };
+
+    // Smallest power of two that is at least count
+    constexpr size_t HashTableSize(size_t count) noexcept
+    {
+        size_t size = 1;
+        while (size < count)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    // Picks a slot for a key from its hash and the seed of its bucket
+    constexpr std::uint64_t MixHash(std::uint64_t hash, std::uint64_t seed) noexcept
+    {
+        hash ^= (seed + 1) * 0x9E3779B97F4A7C15ull;
+        hash = (hash ^ (hash >> 33)) * 0xFF51AFD7ED558CCDull;
+        hash = (hash ^ (hash >> 33)) * 0xC4CEB9FE1A85EC53ull;
+        return hash ^ (hash >> 33);
+    }
+
+    // Lookup tables for an enum, built at compile time by MakeEnumTables.
+    //
+    // names holds each value once, sorted by value. When the values span no more than 2 * N, valueIndex maps
+    // each value (less the smallest) straight to its position in names; otherwise value -> string is a binary search.
+    // String -> value uses a
+    // "hash and displace" perfect hash: keys are hashed once, the hash picks a bucket, and each bucket has a seed
+    // (found at compile time) that sends all of its keys to distinct, otherwise unused slots. A lookup is one hash,
+    // one mix and one case-insensitive comparison.
+    template <typename T, size_t N, size_t K>
+    struct EnumTables
+    {
+        static_assert(K < 0xFFFF, "Too many names for an enum mapping");
+        static constexpr size_t BucketCount = HashTableSize((K + 1) / 2);
+        static constexpr size_t SlotCount = HashTableSize(2 * K);
+
+        std::array<EnumName<T>, N> names{};
+        size_t nameCount = 0;
+        bool hasValueIndex = false;
+        std::array<std::uint16_t, 2 * N> valueIndex{}; // position in names plus one, or zero for an unnamed value
+        std::array<EnumAlias<T>, K> keys{};
+        std::array<std::uint16_t, BucketCount> seeds{};
+        std::array<std::uint16_t, SlotCount> slots{}; // index into keys plus one, or zero for an empty slot
+    };
+
+    // Builds the tables for a mapping. Later duplicates of a value or (case-insensitively) of a name are ignored,
+    // and aliases win over names. Anything that can't be built is a compile error, since the tables are constexpr.
+    template <typename T, size_t N, size_t K>
+    constexpr EnumTables<T, N, K> BuildEnumTables(const EnumName<T>* names, const EnumAlias<T>* aliases, size_t aliasCount)
+    {
+        EnumTables<T, N, K> tables{};
+
+        // Insertion sort by value. Definitions are usually in declaration order already, so this is close to linear.
+        for (size_t i = 0; i < N; ++i)
+        {
+            size_t position = tables.nameCount;
+            while (position > 0 && tables.names[position - 1].value > names[i].value)
+            {
+                --position;
+            }
+            if (position > 0 && tables.names[position - 1].value == names[i].value)
+            {
+                continue;
+            }
+            for (size_t j = tables.nameCount; j > position; --j)
+            {
+                tables.names[j] = tables.names[j - 1];
+            }
+            tables.names[position] = names[i];
+            ++tables.nameCount;
+        }
+        const auto valueRange = static_cast<long long>(tables.names[tables.nameCount - 1].value) -
+                                static_cast<long long>(tables.names[0].value);
+        tables.hasValueIndex = valueRange < static_cast<long long>(2 * N);
+        for (size_t i = 0; tables.hasValueIndex && i < tables.nameCount; ++i)
+        {
+            const auto offset = static_cast<long long>(tables.names[i].value) - static_cast<long long>(tables.names[0].value);
+            tables.valueIndex[static_cast<size_t>(offset)] = static_cast<std::uint16_t>(i + 1);
+        }
+
+        std::array<std::uint64_t, K> hashes{};
+        for (size_t i = 0; i < K; ++i)
+        {
+            tables.keys[i] = (i < aliasCount) ? aliases[i] : EnumAlias<T>{names[i - aliasCount].name, names[i - aliasCount].value};
+            hashes[i] = CaseInsensitiveFnv1a(tables.keys[i].name);
+        }
+
+        // Group keys by bucket, keeping them in definition order within a bucket
+        constexpr size_t bucketMask = EnumTables<T, N, K>::BucketCount - 1;
+        std::array<size_t, EnumTables<T, N, K>::BucketCount + 1> bucketStart{};
+        for (size_t i = 0; i < K; ++i)
+        {
+            ++bucketStart[(hashes[i] & bucketMask) + 1];
+        }
+        size_t largestBucket = 0;
+        for (size_t b = 0; b < EnumTables<T, N, K>::BucketCount; ++b)
+        {
+            largestBucket = (bucketStart[b + 1] > largestBucket) ? bucketStart[b + 1] : largestBucket;
+            bucketStart[b + 1] += bucketStart[b];
+        }
+        std::array<size_t, K> bucketKeys{};
+        std::array<size_t, EnumTables<T, N, K>::BucketCount> bucketFill{};
+        for (size_t i = 0; i < K; ++i)
+        {
+            const size_t bucket = hashes[i] & bucketMask;
+            bucketKeys[bucketStart[bucket] + bucketFill[bucket]++] = i;
+        }
+
+        // Place the largest buckets first, while there is the most room
+        constexpr size_t slotMask = EnumTables<T, N, K>::SlotCount - 1;
+        constexpr size_t maxBucketSize = 32;
+        for (size_t size = largestBucket; size > 0; --size)
+        {
+            for (size_t b = 0; b < EnumTables<T, N, K>::BucketCount; ++b)
+            {
+                if (bucketStart[b + 1] - bucketStart[b] != size)
+                {
+                    continue;
+                }
+                if (size > maxBucketSize)
+                {
+                    throw std::logic_error("Enum mapping bucket is too large");
+                }
+
+                std::array<size_t, maxBucketSize> members{};
+                size_t memberCount = 0;
+                for (size_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k)
+                {
+                    const size_t key = bucketKeys[k];
+                    bool duplicate = false;
+                    for (size_t m = 0; m < memberCount; ++m)
+                    {
+                        duplicate = duplicate || (hashes[members[m]] == hashes[key] &&
+                                                  CaseInsensitiveEquals(tables.keys[members[m]].name, tables.keys[key].name));
+                    }
+                    if (!duplicate)
+                    {
+                        members[memberCount++] = key;
+                    }
+                }
+
+                bool placed = false;
+                for (std::uint64_t seed = 0; !placed && seed < 0xFFFF; ++seed)
+                {
+                    placed = true;
+                    for (size_t m = 0; placed && m < memberCount; ++m)
+                    {
+                        const size_t slot = MixHash(hashes[members[m]], seed) & slotMask;
+                        placed = (tables.slots[slot] == 0);
+                        for (size_t other = 0; placed && other < m; ++other)
+                        {
+                            placed = ((MixHash(hashes[members[other]], seed) & slotMask) != slot);
+                        }
+                    }
+                    if (placed)
+                    {
+                        tables.seeds[b] = static_cast<std::uint16_t>(seed);
+                        for (size_t m = 0; m < memberCount; ++m)
+                        {
+                            tables.slots[MixHash(hashes[members[m]], seed) & slotMask] = static_cast<std::uint16_t>(members[m] + 1);
+                        }
+                    }
+                }
+                if (!placed)
+                {
+                    throw std::logic_error("No perfect hash seed found for enum mapping");
+                }
+            }
+        }
+
+        return tables;
+    }
+
+    template <typename T, size_t N>
+    constexpr EnumTables<T, N, N> MakeEnumTables(const EnumName<T> (&names)[N])
+    {
+        return BuildEnumTables<T, N, N>(names, nullptr, 0);
+    }
+
+    // names is the forward list; aliases are additional strings that map to a value but are never produced by it
+    template <typename T, size_t N, size_t M>
+    constexpr EnumTables<T, N, N + M> MakeEnumTables(const EnumName<T> (&names)[N], const EnumAlias<T> (&aliases)[M])
+    {
+        return BuildEnumTables<T, N, N + M>(names, aliases, M);
+    }
+
+    // Size-independent view of an EnumTables, usable in constant expressions
+    template <typename T>
+    class EnumLookup
     {
     public:
-        // Initialize with a single list -> automatically generate reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-            _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
+        template <size_t N, size_t K>
+        constexpr EnumLookup(const EnumTables<T, N, K>& tables) :
+            _names(tables.names.data()), _nameCount(tables.nameCount),
+            _valueIndex(tables.hasValueIndex ? tables.valueIndex.data() : nullptr), _valueIndexSize(2 * N),
+            _keys(tables.keys.data()), _seeds(tables.seeds.data()), _bucketMask(EnumTables<T, N, K>::BucketCount - 1),
+            _slots(tables.slots.data()), _slotMask(EnumTables<T, N, K>::SlotCount - 1)
+        {
+        }
+
+        size_t size() const noexcept
+        {
+            return _nameCount;
+        }
+
+        const EnumName<T>& nameAt(size_t index) const noexcept
         {
-            _GenerateStringToEnumMap();
+            return _names[index];
         }
 
-        // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
-        // to the generated reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2) :
-            _enumToString{t1.begin(), t1.end()}, _stringToEnum(t2.begin(), t2.end())
+        // Position of t in the sorted names
+        size_t indexOf(T t) const
         {
-            _GenerateStringToEnumMap();
+            if (_nameCount != 0)
+            {
+                if (_valueIndex)
+                {
+                    const auto offset = static_cast<long long>(t) - static_cast<long long>(_names[0].value);
+                    if (offset >= 0 && static_cast<size_t>(offset) < _valueIndexSize && _valueIndex[offset] != 0)
+                    {
+                        return _valueIndex[offset] - 1u;
+                    }
+                }
+                else
+                {
+                    const auto name = std::lower_bound(
+                        _names, _names + _nameCount, t, [](const EnumName<T>& entry, T value) { return entry.value < value; });
+                    if (name != _names + _nameCount && name->value == t)
+                    {
+                        return static_cast<size_t>(name - _names);
+                    }
+                }
+            }
+            throw std::out_of_range("Enum value has no name");
+        }
+
+        // Value whose name or alias matches str case-insensitively, or nullptr
+        const T* find(std::string_view str) const noexcept
+        {
+            const std::uint64_t hash = CaseInsensitiveFnv1a(str);
+            const std::uint16_t key = _slots[MixHash(hash, _seeds[hash & _bucketMask]) & _slotMask];
+            if (key != 0 && CaseInsensitiveEquals(_keys[key - 1].name, str))
+            {
+                return &_keys[key - 1].value;
+            }
+            return nullptr;
+        }
+
+    private:
+        const EnumName<T>* _names;
+        size_t _nameCount;
+        const std::uint16_t* _valueIndex;
+        size_t _valueIndexSize;
+        const EnumAlias<T>* _keys;
+        const std::uint16_t* _seeds;
+        size_t _bucketMask;
+        const std::uint16_t* _slots;
+        size_t _slotMask;
+    };
+
+    // Manage mapping T<->std::string using tables generated at compile time. Only the std::string names handed out
+    // by toString are created at runtime, the first time the mapping is used.
+    template <typename T>
+    class EnumMapping
+    {
+    public:
+        EnumMapping(const EnumLookup<T>& lookup) : _lookup(lookup)
+        {
+            _strings.reserve(_lookup.size());
+            for (size_t i = 0; i < _lookup.size(); ++i)
+            {
+                _strings.emplace_back(_lookup.nameAt(i).name);
+            }
         }
 
         const std::string& toString(T t) const
         {
-            return _enumToString.at(t);
+            return _strings[_lookup.indexOf(t)];
         }
         T fromString(const std::string& str) const
         {
-            return _stringToEnum.at(str);
+            if (const T* value = _lookup.find(str))
+            {
+                return *value;
+            }
+            throw std::out_of_range("Invalid enum string: " + str);
+        }
+
+        // Like fromString, but returns nullptr rather than throwing if str doesn't map
+        const T* find(std::string_view str) const noexcept
+        {
+            return _lookup.find(str);
         }
 
-    private:
-        inline void _GenerateStringToEnumMap()
+        // Every value that has a name, in ascending order
+        std::vector<T> values() const
         {
-            for (const auto& kv : _enumToString)
+            std::vector<T> result;
+            result.reserve(_lookup.size());
+            for (size_t i = 0; i < _lookup.size(); ++i)
             {
-                _stringToEnum.emplace(kv.second, kv.first);
+                result.push_back(_lookup.nameAt(i).value);
             }
+            return result;
         }
 
-        const std::unordered_map<T, std::string, EnumHash> _enumToString;
-        std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+    private:
+        const EnumLookup<T> _lookup;
+        std::vector<std::string> _strings;
     };
 } // namespace EnumHelpers
 
@@ -89,12 +409,16 @@ namespace EnumHelpers
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t);
 
+// The arguments are either a single list of {value, "name"} pairs, or that list followed by a list of
+// {"alias", value} pairs that are accepted by FromString but never produced by ToString.
 #define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...) \
     namespace EnumHelpers \
     { \
+        static constexpr auto ENUMTYPE##Tables = MakeEnumTables<ENUMTYPE>(__VA_ARGS__); \
+        static constexpr EnumLookup<ENUMTYPE> ENUMTYPE##Lookup{ENUMTYPE##Tables}; \
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum() \
         { \
-            static const EnumMapping<ENUMTYPE> generatedEnum __VA_ARGS__; \
+            static const EnumMapping<ENUMTYPE> generatedEnum{ENUMTYPE##Lookup}; \
             return generatedEnum; \
         } \
     } \
@@ -108,13 +432,10 @@ namespace EnumHelpers
     _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t) \
     { \
-        try \
-        { \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
-        } \
-        catch (const std::out_of_range&) \
+        if (const ENUMTYPE* value = EnumHelpers::ENUMTYPE##Lookup.find(t)) \
         { \
-            throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
+            return *value; \
         } \
+        throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
     }
 } // namespace AdaptiveCards
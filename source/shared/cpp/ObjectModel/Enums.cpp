@@ -376,7 +376,7 @@ namespace AdaptiveCards
             {SeparatorThickness::Default, "default"},
             {SeparatorThickness::Thick, "thick"}});
 
-    DEFINE_ADAPTIVECARD_ENUM(ImageStyle, {
+    DEFINE_ADAPTIVECARD_ENUM(ImageStyle,
             {
                 {ImageStyle::Default, "default"},
                 {ImageStyle::Person, "person"},
@@ -384,7 +384,7 @@ namespace AdaptiveCards
             },
             {
                 {"normal", ImageStyle::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
     DEFINE_ADAPTIVECARD_ENUM(IconSize, {
         {IconSize::xxSmall, "xxSmall"},
@@ -461,7 +461,7 @@ namespace AdaptiveCards
             {TextStyle::Default, "default"},
             {TextStyle::Heading, "heading"}});
 
-    DEFINE_ADAPTIVECARD_ENUM(TextWeight, {
+    DEFINE_ADAPTIVECARD_ENUM(TextWeight,
             {
                 {TextWeight::Bolder, "Bolder"},
                 {TextWeight::Lighter, "Lighter"},
@@ -469,9 +469,9 @@ namespace AdaptiveCards
             },
             {
                 {"Normal", TextWeight::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
-    DEFINE_ADAPTIVECARD_ENUM(TextSize, {
+    DEFINE_ADAPTIVECARD_ENUM(TextSize,
             {
                 {TextSize::ExtraLarge, "ExtraLarge"},
                 {TextSize::Large, "Large"},
@@ -481,7 +481,7 @@ namespace AdaptiveCards
             },
             {
                 {"Normal", TextSize::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
     DEFINE_ADAPTIVECARD_ENUM(FontType, {
             {FontType::Default, "Default"},
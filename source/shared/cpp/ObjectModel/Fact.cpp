@@ -26,7 +26,7 @@ std::shared_ptr<Fact> Fact::Deserialize(ParseContext& context, const Json::Value
             WarningStatusCode::RequiredPropertyMissing,
             "non-empty string has to be given for either title or value, none given"));
     }
-    auto fact = std::make_shared<Fact>(title, value);
+    auto fact = context.MakeShared<Fact>(title, value);
     fact->SetLanguage(context.GetLanguage());
 
     return fact;
@@ -65,5 +65,6 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::Facts});
+    m_knownProperties = &knownProperties;
 }
@@ -9,27 +9,29 @@
 namespace AdaptiveCards
 {
 FeatureRegistration::FeatureRegistration() :
-    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, c_sharedModelVersion}}
+    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, {c_sharedModelVersion, SemanticVersion(c_sharedModelVersion)}}}
 {
 }
 
 void FeatureRegistration::AddFeature(std::string const& featureName, const std::string& featureVersion)
 {
     // first, validate the version string. we only support "*" or a semantic version string (e.g. "1.0", or "1.2.3.4")
+    std::optional<SemanticVersion> semanticVersion;
     if (featureVersion != "*")
     {
         // the below will throw if the version is invalid
-        const SemanticVersion version(featureVersion);
+        semanticVersion = SemanticVersion(featureVersion);
     }
 
-    if (m_supportedFeatures.find(featureName) == m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature == m_supportedFeatures.end())
     {
-        m_supportedFeatures[featureName] = featureVersion;
+        m_supportedFeatures.emplace(featureName, Feature{featureVersion, semanticVersion});
     }
     else
     {
         // only allow a duplicate add attempt if the version is the same.
-        if (m_supportedFeatures[featureName] != featureVersion)
+        if (feature->second.version != featureVersion)
         {
             throw AdaptiveCardParseException(
                 ErrorStatusCode::InvalidPropertyValue, "Attempting to add a feature with a differing version");
@@ -56,13 +58,21 @@ SemanticVersion FeatureRegistration::GetAdaptiveCardsVersion() const
 
 std::string FeatureRegistration::GetFeatureVersion(const std::string& featureName) const
 {
-    if (m_supportedFeatures.find(featureName) != m_supportedFeatures.end())
-    {
-        return m_supportedFeatures.at(featureName);
-    }
-    else
+    const auto feature = m_supportedFeatures.find(featureName);
+    return (feature != m_supportedFeatures.end()) ? feature->second.version : "";
+}
+
+bool FeatureRegistration::SupportsFeature(const std::string& featureName, const SemanticVersion& version) const
+{
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature == m_supportedFeatures.end())
     {
-        return "";
+        // host doesn't provide this feature
+        return false;
     }
+
+    // a host that provides any version ("*") meets every requirement
+    const auto& providedVersion = feature->second.semanticVersion;
+    return !providedVersion || !(*providedVersion < version);
 }
 } // namespace AdaptiveCards
@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "ParseUtil.h"
+#include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
@@ -18,7 +19,7 @@ struct CaseInsensitiveKeyHash
 {
     size_t operator()(const std::string& keyVal) const
     {
-        return std::hash<std::string>{}(ParseUtil::ToLowercase(keyVal));
+        return static_cast<size_t>(EnumHelpers::CaseInsensitiveFnv1a(keyVal));
     }
 };
 
@@ -26,11 +27,10 @@ struct CaseInsensitiveKeyEquals
 {
     bool operator()(const std::string& leftVal, const std::string& rightVal) const
     {
-        return (ParseUtil::ToLowercase(leftVal) == ParseUtil::ToLowercase(rightVal));
+        return EnumHelpers::CaseInsensitiveEquals(leftVal, rightVal);
     }
 };
 
-class SemanticVersion;
 class FeatureRegistration
 {
 public:
@@ -41,7 +41,17 @@ public:
     SemanticVersion GetAdaptiveCardsVersion() const;
     std::string GetFeatureVersion(const std::string& featureName) const;
 
+    // Returns whether the host provides featureName at version or later. Doesn't allocate.
+    bool SupportsFeature(const std::string& featureName, const SemanticVersion& version) const;
+
 private:
-    std::unordered_map<std::string, std::string, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
+    struct Feature
+    {
+        std::string version;
+        // The version parsed when the feature was added, or nullopt for "*" (any version)
+        std::optional<SemanticVersion> semanticVersion;
+    };
+
+    std::unordered_map<std::string, Feature, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
 };
 } // namespace AdaptiveCards
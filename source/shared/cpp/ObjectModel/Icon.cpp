@@ -127,12 +127,14 @@ std::shared_ptr<BaseCardElement> IconParser::DeserializeWithoutCheckingType(Pars
 
 void Icon::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Name),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Name,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::SelectAction});
+    m_knownProperties = &knownProperties;
 }
 
 void Icon::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -106,11 +106,13 @@ std::shared_ptr<IconInfo> IconInfo::Deserialize(const Json::Value& json)
 
 void IconInfo::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Name),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const KnownProperties knownProperties(
+        nullptr,
+        {AdaptiveCardSchemaKey::Name,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 std::string IconInfo::GetSVGPath() const
@@ -8,6 +8,7 @@
 //
 #pragma once
 
+#include "KnownProperties.h"
 #include "ParseContext.h"
 
 namespace AdaptiveCards {
@@ -42,7 +43,7 @@ namespace AdaptiveCards {
         std::string m_name;
 
     protected:
-        std::unordered_set<std::string> m_knownProperties;
+        const KnownProperties* m_knownProperties;
 
     private:
         void PopulateKnownPropertiesSet();
@@ -252,16 +252,18 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
 void Image::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::BackgroundColor,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Url,
+         AdaptiveCardSchemaKey::Width});
+    m_knownProperties = &knownProperties;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -80,9 +80,11 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Images,
+         AdaptiveCardSchemaKey::ImageSize});
+    m_knownProperties = &knownProperties;
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
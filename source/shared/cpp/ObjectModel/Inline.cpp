@@ -34,17 +34,17 @@ std::string Inline::GetInlineTypeString() const
 
 const Json::Value& Inline::GetAdditionalProperties() const
 {
-    return m_additionalProperties;
+    return m_additionalProperties.Get();
 }
 
 void Inline::SetAdditionalProperties(Json::Value&& value)
 {
-    m_additionalProperties = std::move(value);
+    m_additionalProperties.Set(std::move(value));
 }
 
 void Inline::SetAdditionalProperties(const Json::Value& value)
 {
-    m_additionalProperties = value;
+    m_additionalProperties.Set(value);
 }
 
 std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::Value& json) {
@@ -65,5 +65,6 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const KnownProperties knownProperties(nullptr, {AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
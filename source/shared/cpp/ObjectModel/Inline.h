@@ -33,8 +33,8 @@ public:
     void SetAdditionalProperties(const Json::Value& additionalProperties);
 
 protected:
-    std::unordered_set<std::string> m_knownProperties;
-    Json::Value m_additionalProperties;
+    const KnownProperties* m_knownProperties;
+    AdditionalProperties m_additionalProperties;
 
 private:
     void PopulateKnownPropertiesSet();
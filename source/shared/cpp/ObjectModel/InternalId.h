@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include <atomic>
 
 namespace AdaptiveCards
 {
@@ -40,7 +41,14 @@ public:
     }
 
 private:
-    static unsigned int s_currentInternalId;
+    // Each thread hands out ids from its own block, taking a new block from the process wide counter when it runs
+    // out. That keeps ids unique across threads without parses on different threads contending for the counter.
+    // The current id is kept per thread so that an element picks up the id its parser was given on the same thread.
+    static constexpr unsigned int InternalIdBlockSize = 256;
+    static std::atomic<unsigned int> s_nextInternalIdBlock;
+    static thread_local unsigned int s_currentInternalId;
+    static thread_local unsigned int s_nextInternalId;
+    static thread_local unsigned int s_internalIdBlockEnd;
     InternalId(const unsigned int id);
     unsigned int m_internalId;
 };
@@ -0,0 +1,277 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonWriter.h"
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr char c_hexDigits[] = "0123456789abcdef";
+constexpr unsigned int c_replacementCharacter = 0xFFFD;
+
+// Decodes the code point starting at current and leaves current on its last byte. Invalid sequences decode to the
+// replacement character, exactly as jsoncpp's writer decodes them.
+unsigned int DecodeUtf8(const char*& current, const char* end)
+{
+    const unsigned int firstByte = static_cast<unsigned char>(*current);
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    const auto continuation = [current](int index) { return static_cast<unsigned int>(current[index]) & 0x3F; };
+    if (firstByte < 0xE0)
+    {
+        if (end - current < 2)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint = ((firstByte & 0x1F) << 6) | continuation(1);
+        current += 1;
+        return codePoint < 0x80 ? c_replacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        if (end - current < 3)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint = ((firstByte & 0x0F) << 12) | (continuation(1) << 6) | continuation(2);
+        current += 2;
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+        {
+            return c_replacementCharacter;
+        }
+        return codePoint < 0x800 ? c_replacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        if (end - current < 4)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint =
+            ((firstByte & 0x07) << 24) | (continuation(1) << 12) | (continuation(2) << 6) | continuation(3);
+        current += 3;
+        return codePoint < 0x10000 ? c_replacementCharacter : codePoint;
+    }
+
+    return c_replacementCharacter;
+}
+
+void AppendUnicodeEscape(std::string& output, unsigned int codeUnit)
+{
+    const char escape[] = {'\\',
+                           'u',
+                           c_hexDigits[(codeUnit >> 12) & 0xF],
+                           c_hexDigits[(codeUnit >> 8) & 0xF],
+                           c_hexDigits[(codeUnit >> 4) & 0xF],
+                           c_hexDigits[codeUnit & 0xF]};
+    output.append(escape, sizeof(escape));
+}
+
+bool NeedsEscaping(char c)
+{
+    const auto byte = static_cast<unsigned char>(c);
+    return byte < 0x20 || byte >= 0x80 || c == '"' || c == '\\';
+}
+} // namespace
+
+void JsonWriter::Write(const Json::Value& json)
+{
+    switch (json.type())
+    {
+    case Json::nullValue:
+        m_output.append("null");
+        break;
+    case Json::intValue:
+        WriteInteger(json.asLargestInt());
+        break;
+    case Json::uintValue:
+        WriteInteger(json.asLargestUInt());
+        break;
+    case Json::realValue:
+        WriteDouble(json.asDouble());
+        break;
+    case Json::stringValue:
+    {
+        const char* begin;
+        const char* end;
+        if (json.getString(&begin, &end))
+        {
+            WriteString(begin, end - begin);
+        }
+        break;
+    }
+    case Json::booleanValue:
+        m_output.append(json.asBool() ? "true" : "false");
+        break;
+    case Json::arrayValue:
+    {
+        m_output.push_back('[');
+        const Json::ArrayIndex size = json.size();
+        for (Json::ArrayIndex i = 0; i < size; ++i)
+        {
+            if (i != 0)
+            {
+                m_output.push_back(',');
+            }
+            Write(json[i]);
+        }
+        m_output.push_back(']');
+        break;
+    }
+    case Json::objectValue:
+    {
+        // Members come out in the object's (sorted) order, as Value::getMemberNames lists them
+        m_output.push_back('{');
+        bool isFirst = true;
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            if (!isFirst)
+            {
+                m_output.push_back(',');
+            }
+            isFirst = false;
+
+            const char* nameEnd;
+            const char* name = it.memberName(&nameEnd);
+            WriteString(name, nameEnd - name);
+            m_output.push_back(':');
+            Write(*it);
+        }
+        m_output.push_back('}');
+        break;
+    }
+    }
+}
+
+void JsonWriter::WriteString(const char* value, size_t length)
+{
+    const char* const end = value + length;
+    m_output.push_back('"');
+
+    // Most strings need no escaping, so copy runs of plain characters in one go
+    const char* current = value;
+    while (current != end)
+    {
+        const char* run = current;
+        while (current != end && !NeedsEscaping(*current))
+        {
+            ++current;
+        }
+        m_output.append(run, current - run);
+        if (current == end)
+        {
+            break;
+        }
+
+        switch (*current)
+        {
+        case '"':
+            m_output.append("\\\"");
+            break;
+        case '\\':
+            m_output.append("\\\\");
+            break;
+        case '\b':
+            m_output.append("\\b");
+            break;
+        case '\f':
+            m_output.append("\\f");
+            break;
+        case '\n':
+            m_output.append("\\n");
+            break;
+        case '\r':
+            m_output.append("\\r");
+            break;
+        case '\t':
+            m_output.append("\\t");
+            break;
+        default:
+        {
+            // Anything else outside printable ASCII is written as \u escapes, using a surrogate pair for code
+            // points outside the Basic Multilingual Plane
+            unsigned int codePoint = DecodeUtf8(current, end);
+            if (codePoint < 0x10000)
+            {
+                AppendUnicodeEscape(m_output, codePoint);
+            }
+            else
+            {
+                codePoint -= 0x10000;
+                AppendUnicodeEscape(m_output, (codePoint >> 10) + 0xD800);
+                AppendUnicodeEscape(m_output, (codePoint & 0x3FF) + 0xDC00);
+            }
+            break;
+        }
+        }
+        ++current;
+    }
+
+    m_output.push_back('"');
+}
+
+void JsonWriter::WriteDouble(double value)
+{
+    if (!std::isfinite(value))
+    {
+        m_output.append(std::isnan(value) ? "null" : (value < 0 ? "-1e+9999" : "1e+9999"));
+        return;
+    }
+
+    char buffer[36];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    const size_t start = m_output.size();
+    m_output.append(buffer, length);
+
+    // Locales that use a comma for the decimal point still get a point, and a value that came in as a double keeps
+    // a fractional part so that it's read back as one
+    bool isReal = false;
+    for (size_t i = start; i < m_output.size(); ++i)
+    {
+        if (m_output[i] == ',')
+        {
+            m_output[i] = '.';
+        }
+        isReal = isReal || m_output[i] == '.' || m_output[i] == 'e';
+    }
+    if (!isReal)
+    {
+        m_output.append(".0");
+    }
+}
+
+template <typename T> void JsonWriter::WriteInteger(T value)
+{
+    char buffer[24];
+    char* current = buffer + sizeof(buffer);
+    bool isNegative = false;
+    // Work in the unsigned type so that the most negative value doesn't overflow
+    auto magnitude = static_cast<std::make_unsigned_t<T>>(value);
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            isNegative = true;
+            magnitude = 0 - magnitude;
+        }
+    }
+    do
+    {
+        *--current = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (isNegative)
+    {
+        *--current = '-';
+    }
+    m_output.append(current, buffer + sizeof(buffer) - current);
+}
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Writes JSON values in compact form straight into a string, with the same output as a Json::StreamWriter with no
+// indentation or comments (the form ParseUtil::JsonToString has always produced). Unlike the StreamWriter, it
+// doesn't go through an ostream or build a string per value, and its buffer can be reused between values.
+class JsonWriter
+{
+public:
+    JsonWriter() = default;
+
+    // Appends json to the output
+    void Write(const Json::Value& json);
+
+    const std::string& GetOutput() const
+    {
+        return m_output;
+    }
+    std::string TakeOutput()
+    {
+        return std::move(m_output);
+    }
+    void Clear()
+    {
+        m_output.clear();
+    }
+
+private:
+    void WriteString(const char* value, size_t length);
+    void WriteDouble(double value);
+    template <typename T> void WriteInteger(T value);
+
+    std::string m_output;
+};
+} // namespace AdaptiveCards
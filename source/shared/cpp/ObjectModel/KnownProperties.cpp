@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "KnownProperties.h"
+
+using namespace AdaptiveCards;
+
+KnownProperties::KnownProperties(const KnownProperties* base,
+                                 std::initializer_list<AdaptiveCardSchemaKey> keys,
+                                 const std::unordered_set<std::string>& names) :
+    m_names(names)
+{
+    if (base)
+    {
+        m_names.insert(base->m_names.begin(), base->m_names.end());
+    }
+    for (const auto key : keys)
+    {
+        m_names.insert(AdaptiveCardSchemaKeyToString(key));
+    }
+
+    m_lookup.reserve(m_names.size());
+    for (const auto& name : m_names)
+    {
+        m_lookup.insert(name);
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+#include <string_view>
+
+namespace AdaptiveCards
+{
+// The JSON properties that an element type parses itself. Anything else found on an element is kept as an
+// additional property (see HandleUnknownProperties).
+//
+// Every instance of a type knows the same properties, so each type builds its table once, on top of its base type's
+// table, and its instances just point at it:
+//
+//     void Container::PopulateKnownPropertiesSet()
+//     {
+//         static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::Bleed, ...});
+//         m_knownProperties = &knownProperties;
+//     }
+//
+// Base constructors always run the same way, so the base table a type sees the first time is the one it always sees.
+class KnownProperties
+{
+public:
+    KnownProperties(const KnownProperties* base,
+                    std::initializer_list<AdaptiveCardSchemaKey> keys,
+                    const std::unordered_set<std::string>& names = {});
+
+    // m_lookup points into m_names
+    KnownProperties(const KnownProperties&) = delete;
+    KnownProperties& operator=(const KnownProperties&) = delete;
+
+    bool Contains(std::string_view name) const
+    {
+        return m_lookup.find(name) != m_lookup.end();
+    }
+
+    const std::unordered_set<std::string>& GetNames() const
+    {
+        return m_names;
+    }
+
+private:
+    std::unordered_set<std::string> m_names;
+    std::unordered_set<std::string_view> m_lookup;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,155 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MappedFile.h"
+#include "AdaptiveCardParseException.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+using namespace AdaptiveCards;
+
+namespace
+{
+[[noreturn]] void ThrowUnreadableFile(const std::string& path)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Unable to read file: " + path);
+}
+
+#ifndef _WIN32
+// Closes the descriptor on every exit path. A mapping stays valid after its descriptor is closed.
+class FileDescriptor
+{
+public:
+    explicit FileDescriptor(int fileDescriptor) : m_fileDescriptor(fileDescriptor) {}
+    ~FileDescriptor()
+    {
+        if (m_fileDescriptor >= 0)
+        {
+            close(m_fileDescriptor);
+        }
+    }
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int Get() const { return m_fileDescriptor; }
+
+private:
+    int m_fileDescriptor;
+};
+
+// Reads until end of file. sizeHint is only used to size the buffer up front, since the file may not report its size
+// (pipes) or may change while it is being read.
+bool ReadAll(int fileDescriptor, size_t sizeHint, std::vector<char>& contents)
+{
+    constexpr size_t c_minimumRead = 4096;
+    contents.resize(std::max(sizeHint, c_minimumRead));
+
+    size_t size = 0;
+    while (true)
+    {
+        if (size == contents.size())
+        {
+            contents.resize(contents.size() * 2);
+        }
+
+        const ssize_t bytesRead = read(fileDescriptor, contents.data() + size, contents.size() - size);
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        else if (bytesRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        size += static_cast<size_t>(bytesRead);
+    }
+
+    contents.resize(size);
+    return true;
+}
+#endif // _WIN32
+} // namespace
+
+MappedFile::MappedFile(const std::string& path) : m_data(nullptr), m_size(0), m_mapping(nullptr)
+{
+#ifdef _WIN32
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        ThrowUnreadableFile(path);
+    }
+
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    m_contents.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    if (!file.read(m_contents.data(), m_contents.size()))
+    {
+        ThrowUnreadableFile(path);
+    }
+#else
+    const FileDescriptor file(open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    struct stat fileStatus{};
+    if (file.Get() < 0 || fstat(file.Get(), &fileStatus) != 0)
+    {
+        ThrowUnreadableFile(path);
+    }
+
+    const bool isRegularFile = S_ISREG(fileStatus.st_mode);
+    const size_t fileSize = isRegularFile ? static_cast<size_t>(fileStatus.st_size) : 0;
+
+    // Zero length mappings are not allowed, so empty files also take the read() path
+    if (fileSize > 0)
+    {
+        void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file.Get(), 0);
+        if (mapping != MAP_FAILED)
+        {
+            // The whole file is about to be read front to back
+            madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+            m_mapping = mapping;
+            m_data = static_cast<const char*>(mapping);
+            m_size = fileSize;
+            return;
+        }
+    }
+
+    if (!ReadAll(file.Get(), fileSize, m_contents))
+    {
+        ThrowUnreadableFile(path);
+    }
+#endif // _WIN32
+
+    m_data = m_contents.data();
+    m_size = m_contents.size();
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if (m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_size);
+    }
+#endif // _WIN32
+}
+
+const char* MappedFile::GetData() const
+{
+    return m_data;
+}
+
+size_t MappedFile::GetSize() const
+{
+    return m_size;
+}
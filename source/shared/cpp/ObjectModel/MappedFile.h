@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Read-only view of a whole file as one contiguous buffer.
+//
+// On POSIX platforms the file is memory mapped so the bytes are handed to the JSON reader straight from the page
+// cache. If the file can't be mapped (an empty file, a pipe, a file system without mmap support) it is read with
+// read() into a buffer sized from fstat instead. Other platforms always use the buffered path.
+class MappedFile
+{
+public:
+    // Throws AdaptiveCardParseException if the file can't be opened or read
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* GetData() const;
+    size_t GetSize() const;
+
+private:
+    const char* m_data;
+    size_t m_size;
+    void* m_mapping;
+    std::vector<char> m_contents;
+};
+} // namespace AdaptiveCards
@@ -68,10 +68,12 @@ std::vector<std::shared_ptr<CaptionSource>>& Media::GetCaptionSources()
 
 void Media::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Poster,
+         AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::Sources});
+    m_knownProperties = &knownProperties;
 }
 
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <memory_resource>
+
+namespace AdaptiveCards
+{
+// Allocator over a std::pmr::memory_resource that shares ownership of the resource, for use with std::allocate_shared.
+// Every object allocated through it keeps the resource alive, so an arena such as std::pmr::monotonic_buffer_resource
+// is released in one go once the last object in it is destroyed. See ParseContext::SetMemoryResource.
+template <typename T> class MemoryResourceAllocator
+{
+public:
+    using value_type = T;
+
+    explicit MemoryResourceAllocator(std::shared_ptr<std::pmr::memory_resource> memoryResource) :
+        m_memoryResource(std::move(memoryResource))
+    {
+    }
+
+    template <typename U>
+    MemoryResourceAllocator(const MemoryResourceAllocator<U>& other) : m_memoryResource(other.GetMemoryResource())
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(m_memoryResource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count)
+    {
+        m_memoryResource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    const std::shared_ptr<std::pmr::memory_resource>& GetMemoryResource() const
+    {
+        return m_memoryResource;
+    }
+
+    template <typename U> bool operator==(const MemoryResourceAllocator<U>& other) const
+    {
+        return m_memoryResource == other.GetMemoryResource();
+    }
+    template <typename U> bool operator!=(const MemoryResourceAllocator<U>& other) const
+    {
+        return m_memoryResource != other.GetMemoryResource();
+    }
+
+private:
+    std::shared_ptr<std::pmr::memory_resource> m_memoryResource;
+};
+} // namespace AdaptiveCards
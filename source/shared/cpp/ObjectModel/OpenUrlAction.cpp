@@ -49,5 +49,6 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
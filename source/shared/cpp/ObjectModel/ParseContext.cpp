@@ -9,18 +9,21 @@
 namespace AdaptiveCards
 {
 ParseContext::ParseContext() :
-    elementParserRegistration{std::make_shared<ElementParserRegistration>()},
-    actionParserRegistration{std::make_shared<ActionParserRegistration>()}, warnings{}, m_elementIds{}, m_idStack{},
-    m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false)
+    elementParserRegistration{ElementParserRegistration::GetDefault()},
+    actionParserRegistration{ActionParserRegistration::GetDefault()}, warnings{},
+    m_elementIds{std::make_shared<std::unordered_multimap<std::string, AdaptiveCards::InternalId>>()},
+    m_isParallelFork(false), m_forkElementIds{}, m_idStack{}, m_parentalContainerStyles{}, m_parentalPadding{},
+    m_parentalBleedDirection{}, m_canFallbackToAncestor(false), m_deferShowCardParsing(false)
 {
 }
 
 ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementRegistration, std::shared_ptr<ActionParserRegistration> actionRegistration) :
-    warnings{}, m_elementIds{}, m_idStack{}, m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{},
-    m_canFallbackToAncestor(false)
+    warnings{}, m_elementIds{std::make_shared<std::unordered_multimap<std::string, AdaptiveCards::InternalId>>()},
+    m_isParallelFork(false), m_forkElementIds{}, m_idStack{}, m_parentalContainerStyles{}, m_parentalPadding{},
+    m_parentalBleedDirection{}, m_canFallbackToAncestor(false), m_deferShowCardParsing(false)
 {
-    elementParserRegistration = (elementRegistration) ? elementRegistration : std::make_shared<ElementParserRegistration>();
-    actionParserRegistration = (actionRegistration) ? actionRegistration : std::make_shared<ActionParserRegistration>();
+    elementParserRegistration = (elementRegistration) ? elementRegistration : ElementParserRegistration::GetDefault();
+    actionParserRegistration = (actionRegistration) ? actionRegistration : ActionParserRegistration::GetDefault();
 }
 
 // Detecting ID collisions
@@ -84,8 +87,8 @@ ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementReg
 // before we visit an element, and the pop the state as we're leaving it. We perform our validation as we pop an
 // element off the stack. To facilitate this, we wrap parsers such that we can push/pop around the deserialize
 // calls, obviating the need for parser implementors to remember to push/pop themselves (see
-// ActionParserRegistration::GetParser(), ElementParserRegistration::GetParser, and the wrapper classes they
-// consume). Note that we will also push/pop when parsing an element's fallback content.
+// ActionParserRegistration::TryDeserialize(), ElementParserRegistration::TryDeserialize(), and the wrapper classes
+// whose DeserializeWithIdTracking they use). Note that we will also push/pop when parsing an element's fallback content.
 //
 // So how *do* we detect collisions? When we push an element we're visiting, we supply three pieces of information
 // for reference: the ID property, the element's internal ID, and whether we're parsing fallback content or not.
@@ -170,7 +173,7 @@ void ParseContext::PopElement()
         const auto& nearestFallbackId = GetNearestFallbackId(elementInternalId);
 
         // Walk through the list of elements we've seen with this ID
-        for (auto currentEntry = m_elementIds.find(elementId); currentEntry != m_elementIds.end(); ++currentEntry)
+        for (auto currentEntry = m_elementIds->find(elementId); currentEntry != m_elementIds->end(); ++currentEntry)
         {
             const AdaptiveCards::InternalId& entryFallbackId = currentEntry->second;
 
@@ -219,7 +222,11 @@ void ParseContext::PopElement()
         // no need to add an entry for this element if it's fallback (we'll add one when we parse it for non-fallback)
         if (!isFallback)
         {
-            m_elementIds.emplace(std::make_pair(elementId, nearestFallbackId));
+            m_elementIds->emplace(std::make_pair(elementId, nearestFallbackId));
+            if (m_isParallelFork)
+            {
+                m_forkElementIds.emplace_back(elementId, nearestFallbackId);
+            }
         }
     }
 
@@ -246,6 +253,72 @@ const AdaptiveCards::InternalId ParseContext::GetNearestFallbackId(const Adaptiv
     return invalidId;
 }
 
+std::shared_ptr<ParseContext> ParseContext::ForkForDeferredParse() const
+{
+    auto fork = std::make_shared<ParseContext>(*this);
+    fork->warnings.clear();
+    fork->m_memoryResource.reset();
+    // The deferred card is parsed from a copy of its JSON, and the fork shouldn't keep the document alive
+    fork->m_sourceDocument.reset();
+    return fork;
+}
+
+void ParseContext::UnshareElementIds()
+{
+    m_elementIds = std::make_shared<std::unordered_multimap<std::string, AdaptiveCards::InternalId>>(*m_elementIds);
+}
+
+ParseContext ParseContext::ForkForParallelParse() const
+{
+    ParseContext fork(*this);
+    fork.warnings.clear();
+    fork.m_elementIds = std::make_shared<std::unordered_multimap<std::string, AdaptiveCards::InternalId>>();
+    fork.m_isParallelFork = true;
+    fork.m_forkElementIds.clear();
+    fork.m_parseThreadPool.reset();
+    if (m_memoryResource)
+    {
+        fork.m_memoryResource = std::make_shared<std::pmr::monotonic_buffer_resource>();
+    }
+    return fork;
+}
+
+bool ParseContext::JoinParallelParse(const std::vector<ParseContext>& forks)
+{
+    std::unordered_set<std::string> forkIds;
+    for (const auto& fork : forks)
+    {
+        // Collections restore all of this on the way out. Anything else means a later sibling would have been
+        // parsed with different state.
+        if (fork.m_idStack != m_idStack || fork.m_parentalContainerStyles != m_parentalContainerStyles ||
+            fork.m_parentalPadding != m_parentalPadding || fork.m_parentalBleedDirection != m_parentalBleedDirection ||
+            fork.m_canFallbackToAncestor != m_canFallbackToAncestor || fork.m_language != m_language)
+        {
+            return false;
+        }
+
+        // PopElement only looks at the existing entries when an ID was seen before, and then the outcome can depend
+        // on entries the fork didn't have. With every ID unique, no fork or serial parse ever looked.
+        for (const auto& elementId : fork.m_forkElementIds)
+        {
+            if (!forkIds.insert(elementId.first).second || m_elementIds->count(elementId.first) != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (const auto& fork : forks)
+    {
+        for (const auto& elementId : fork.m_forkElementIds)
+        {
+            m_elementIds->emplace(elementId);
+        }
+        warnings.insert(warnings.end(), fork.warnings.begin(), fork.warnings.end());
+    }
+    return true;
+}
+
 ContainerStyle ParseContext::GetParentalContainerStyle() const
 {
     return m_parentalContainerStyles.size() ? m_parentalContainerStyles.back() : ContainerStyle::Default;
@@ -8,10 +8,13 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "MemoryResourceAllocator.h"
+#include <utility>
 
 namespace AdaptiveCards
 {
 class StyledCollectionElement;
+class ParseThreadPool;
 class ParseContext
 {
 public:
@@ -48,6 +51,101 @@ public:
     void PushBleedDirection(const ContainerBleedDirection direction);
     void PopBleedDirection();
 
+    // When set, the card inside each Action.ShowCard is kept as unparsed JSON and only parsed the first time
+    // ShowCardAction::GetCard() is called (see ShowCardAction.h). Off by default.
+    bool GetDeferShowCardParsing() const
+    {
+        return m_deferShowCardParsing;
+    }
+    void SetDeferShowCardParsing(bool value)
+    {
+        m_deferShowCardParsing = value;
+    }
+
+    // Returns a copy of the current parse state, without any warnings, for parsing a part of the card later on.
+    // The copy shares the list of IDs seen with this context, so IDs found through either context are checked
+    // for collisions against IDs found through the other.
+    std::shared_ptr<ParseContext> ForkForDeferredParse() const;
+
+    // Gives this context its own copy of the list of IDs seen, so that IDs found from now on aren't shared with
+    // the contexts it was forked from or to.
+    void UnshareElementIds();
+
+    // With a thread pool set, large collections of sibling elements are split into runs that are parsed in parallel
+    // on the pool, each with its own fork of this context (see ParseUtil::ParseCollectionItems). Registered parsers
+    // must then be safe to call from several threads at once.
+    const std::shared_ptr<ParseThreadPool>& GetParseThreadPool() const
+    {
+        return m_parseThreadPool;
+    }
+    void SetParseThreadPool(std::shared_ptr<ParseThreadPool> threadPool)
+    {
+        m_parseThreadPool = std::move(threadPool);
+    }
+
+    // With a memory resource set, parsed elements and the card itself are allocated from it instead of the heap.
+    // Every object allocated from the resource keeps it alive, so an arena such as
+    // std::pmr::monotonic_buffer_resource is released in one go once the last of them is destroyed. A resource is
+    // only ever used by one thread at a time: forks made for parallel parsing allocate from arenas of their own, and
+    // deferred ShowCard cards are allocated from the heap.
+    const std::shared_ptr<std::pmr::memory_resource>& GetMemoryResource() const
+    {
+        return m_memoryResource;
+    }
+    void SetMemoryResource(std::shared_ptr<std::pmr::memory_resource> memoryResource)
+    {
+        m_memoryResource = std::move(memoryResource);
+    }
+
+    // Allocates an object for the parsed card, from the memory resource if one is set
+    template <typename T, typename... Args> std::shared_ptr<T> MakeShared(Args&&... args) const
+    {
+        if (m_memoryResource)
+        {
+            return std::allocate_shared<T>(MemoryResourceAllocator<T>(m_memoryResource), std::forward<Args>(args)...);
+        }
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+    // While a card is parsed from a document that the parse owns (see AdaptiveCard::DeserializeFromString), elements
+    // that have additional properties keep a reference to their JSON inside the document instead of copying the
+    // properties out (see AdditionalProperties). It's only set while the JSON being parsed is known to be part of
+    // the document, so registered parsers other than the built-in ones run with it cleared.
+    const std::shared_ptr<const Json::Value>& GetSourceDocument() const
+    {
+        return m_sourceDocument;
+    }
+
+    // Sets the source document until it's destroyed, then puts back the previous one
+    class SourceDocumentScope
+    {
+    public:
+        SourceDocumentScope(ParseContext& context, std::shared_ptr<const Json::Value> document) :
+            m_context(context), m_previous(std::exchange(context.m_sourceDocument, std::move(document)))
+        {
+        }
+        ~SourceDocumentScope()
+        {
+            m_context.m_sourceDocument = std::move(m_previous);
+        }
+
+        SourceDocumentScope(const SourceDocumentScope&) = delete;
+        SourceDocumentScope& operator=(const SourceDocumentScope&) = delete;
+
+    private:
+        ParseContext& m_context;
+        std::shared_ptr<const Json::Value> m_previous;
+    };
+
+    // Returns a copy of the current parse state for parsing a run of sibling elements on another thread. The fork
+    // starts with no warnings and no IDs seen, and parses everything under it serially.
+    ParseContext ForkForParallelParse() const;
+
+    // Folds forks made by ForkForParallelParse back into this context, in document order. Returns false and leaves
+    // this context unchanged if the forks may not have come out the same as a serial parse: if any ID was seen
+    // twice, or if parsing changed state (such as the language) that later siblings would have seen.
+    bool JoinParallelParse(const std::vector<ParseContext>& forks);
+
 private:
     const AdaptiveCards::InternalId GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const;
     // This enum is just a helper to keep track of the position of contents within the std::tuple used in
@@ -63,9 +161,15 @@ private:
     // within an Adaptive Card json file. Specifically, we track which non-empty ids we've seen and correllate them
     // to the internal ID of the element for which it serves fallback (if any). We use unordered_multimap here as
     // duplicate entries are valid in some circumstances (i.e. where fallback content shares an ID with its parent)
+    // The map is shared with contexts forked for deferred parsing (see ForkForDeferredParse).
     //
     //             map ID json property           ->             fallback ID
-    std::unordered_multimap<std::string, AdaptiveCards::InternalId> m_elementIds;
+    std::shared_ptr<std::unordered_multimap<std::string, AdaptiveCards::InternalId>> m_elementIds;
+
+    // A fork made by ForkForParallelParse also lists the entries it adds to m_elementIds, in order, so that
+    // JoinParallelParse can add them to the parent in the same order a serial parse would have.
+    bool m_isParallelFork;
+    std::vector<std::pair<std::string, AdaptiveCards::InternalId>> m_forkElementIds;
 
     // m_idStack is the stack we use during parse time to track the hierarchy of cards as they are encountered.
     // Any time we parse an element we push it on to the stack, parse its children (if any), then pop it off the
@@ -79,6 +183,10 @@ private:
     std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
     bool m_canFallbackToAncestor;
+    bool m_deferShowCardParsing;
     std::string m_language;
+    std::shared_ptr<ParseThreadPool> m_parseThreadPool;
+    std::shared_ptr<std::pmr::memory_resource> m_memoryResource;
+    std::shared_ptr<const Json::Value> m_sourceDocument;
 };
 } // namespace AdaptiveCards
@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseResultCache.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// The object model doesn't track its own size, so an entry is charged for its key plus an estimate of the parsed
+// card. Measured over the scenario cards under samples/, a parsed card holds 8 to 18 times the heap memory of its
+// JSON text, 12 times for a typical card.
+constexpr size_t c_parsedBytesPerJsonByte = 12;
+constexpr size_t c_entryOverheadInBytes = 256;
+
+size_t CombineHash(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+template <typename T> bool IsSameOwner(const std::weak_ptr<T>& cached, const std::shared_ptr<T>& current)
+{
+    // Comparing owners rather than addresses means a registration that was destroyed can never match a new one that
+    // happens to be allocated at the same address.
+    return !cached.owner_before(current) && !current.owner_before(cached);
+}
+} // namespace
+
+ParseResultCache::ParseResultCache(size_t maxSizeInBytes) :
+    m_elementParserRegistration(ElementParserRegistration::GetDefault()),
+    m_actionParserRegistration(ActionParserRegistration::GetDefault()), m_maxSizeInBytes(maxSizeInBytes), m_sizeInBytes(0), m_hits(0), m_misses(0), m_evictions(0)
+{
+}
+
+std::shared_ptr<ParseResult> ParseResultCache::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion)
+{
+    ParseContext context(m_elementParserRegistration, m_actionParserRegistration);
+    return DeserializeFromString(jsonString, rendererVersion, context);
+}
+
+std::shared_ptr<ParseResult> ParseResultCache::DeserializeFromString(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+{
+    // Captured up front because parsing a card with a "lang" property changes the context's language
+    const ParseSettings settings{
+        rendererVersion, context.GetLanguage(), context.GetDeferShowCardParsing(), context.elementParserRegistration, context.actionParserRegistration};
+    const size_t hash = ComputeHash(jsonString, settings);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto cached = Find(hash, jsonString, settings);
+        if (cached != m_entries.end())
+        {
+            ++m_hits;
+            m_entries.splice(m_entries.begin(), m_entries, cached);
+
+            const auto& warnings = cached->parseResult->GetWarnings();
+            context.warnings.insert(context.warnings.end(), warnings.begin(), warnings.end());
+            return cached->parseResult;
+        }
+        ++m_misses;
+    }
+
+    // Parse without holding the lock so that other threads aren't blocked behind a slow card. Two threads missing on
+    // the same card both parse it and the first one to finish is cached.
+    auto parseResult = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+
+    const size_t sizeInBytes = c_entryOverheadInBytes + jsonString.size() * (1 + c_parsedBytesPerJsonByte) +
+                               settings.rendererVersion.size() + settings.language.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (sizeInBytes > m_maxSizeInBytes || Find(hash, jsonString, settings) != m_entries.end())
+    {
+        return parseResult;
+    }
+
+    EvictToFit(m_maxSizeInBytes - sizeInBytes);
+
+    m_entries.push_front(Entry{hash,
+                               jsonString,
+                               settings.rendererVersion,
+                               settings.language,
+                               settings.deferShowCardParsing,
+                               settings.elementParserRegistration,
+                               settings.actionParserRegistration,
+                               parseResult,
+                               sizeInBytes});
+    m_entriesByHash.emplace(hash, m_entries.begin());
+    m_sizeInBytes += sizeInBytes;
+
+    return parseResult;
+}
+
+void ParseResultCache::SetMaxSizeInBytes(size_t maxSizeInBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxSizeInBytes = maxSizeInBytes;
+    EvictToFit(maxSizeInBytes);
+}
+
+size_t ParseResultCache::GetMaxSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_maxSizeInBytes;
+}
+
+void ParseResultCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entriesByHash.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+ParseResultCache::Statistics ParseResultCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return Statistics{m_hits, m_misses, m_evictions, m_entries.size(), m_sizeInBytes};
+}
+
+size_t ParseResultCache::ComputeHash(const std::string& jsonString, const ParseSettings& settings)
+{
+    size_t hash = std::hash<std::string>()(jsonString);
+    hash = CombineHash(hash, std::hash<std::string>()(settings.rendererVersion));
+    hash = CombineHash(hash, std::hash<std::string>()(settings.language));
+    hash = CombineHash(hash, std::hash<bool>()(settings.deferShowCardParsing));
+    hash = CombineHash(hash, std::hash<const void*>()(settings.elementParserRegistration.get()));
+    hash = CombineHash(hash, std::hash<const void*>()(settings.actionParserRegistration.get()));
+    return hash;
+}
+
+std::list<ParseResultCache::Entry>::iterator ParseResultCache::Find(size_t hash, const std::string& jsonString, const ParseSettings& settings)
+{
+    const auto candidates = m_entriesByHash.equal_range(hash);
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+    {
+        const Entry& entry = *candidate->second;
+        if (IsSameOwner(entry.elementParserRegistration, settings.elementParserRegistration) &&
+            IsSameOwner(entry.actionParserRegistration, settings.actionParserRegistration) &&
+            entry.rendererVersion == settings.rendererVersion && entry.language == settings.language &&
+            entry.deferShowCardParsing == settings.deferShowCardParsing && entry.jsonString == jsonString)
+        {
+            return candidate->second;
+        }
+    }
+    return m_entries.end();
+}
+
+void ParseResultCache::EvictToFit(size_t maxSizeInBytes)
+{
+    while (m_sizeInBytes > maxSizeInBytes && !m_entries.empty())
+    {
+        const auto leastRecentlyUsed = std::prev(m_entries.end());
+
+        const auto candidates = m_entriesByHash.equal_range(leastRecentlyUsed->hash);
+        for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+        {
+            if (candidate->second == leastRecentlyUsed)
+            {
+                m_entriesByHash.erase(candidate);
+                break;
+            }
+        }
+
+        m_sizeInBytes -= leastRecentlyUsed->sizeInBytes;
+        m_entries.erase(leastRecentlyUsed);
+        ++m_evictions;
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include <list>
+#include <mutex>
+
+namespace AdaptiveCards
+{
+// Thread safe, size bounded LRU cache of parsed cards, for hosts that render the same card JSON many times.
+//
+// A result is reused only for the same JSON text, renderer version, language, ShowCard deferral setting and the same
+// element and action parser registration objects, since any of those can change what a parse produces. Registrations
+// are matched by identity, so hosts should parse with contexts that share their registration objects (the overload without a context uses
+// registrations owned by the cache), and a host that adds or removes parsers on a registration it has already parsed
+// with should call Clear().
+//
+// Cached results are shared by every caller that hits them and must be treated as read only. Failed parses are not
+// cached, so they throw every time just like AdaptiveCard::DeserializeFromString.
+class ParseResultCache
+{
+public:
+    struct Statistics
+    {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+        size_t entryCount;
+        size_t sizeInBytes;
+    };
+
+    explicit ParseResultCache(size_t maxSizeInBytes);
+
+    ParseResultCache(const ParseResultCache&) = delete;
+    ParseResultCache& operator=(const ParseResultCache&) = delete;
+
+    // Same contract as AdaptiveCard::DeserializeFromString. On a hit the cached warnings are appended to
+    // context.warnings as if the card had been parsed again.
+    std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+    std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
+
+    // Lowering the limit evicts least recently used entries right away
+    void SetMaxSizeInBytes(size_t maxSizeInBytes);
+    size_t GetMaxSizeInBytes() const;
+
+    void Clear();
+    Statistics GetStatistics() const;
+
+private:
+    struct Entry
+    {
+        size_t hash;
+        std::string jsonString;
+        std::string rendererVersion;
+        std::string language;
+        bool deferShowCardParsing;
+        std::weak_ptr<ElementParserRegistration> elementParserRegistration;
+        std::weak_ptr<ActionParserRegistration> actionParserRegistration;
+        std::shared_ptr<ParseResult> parseResult;
+        size_t sizeInBytes;
+    };
+
+    // Everything other than the JSON text that can change the result of a parse
+    struct ParseSettings
+    {
+        std::string rendererVersion;
+        std::string language;
+        bool deferShowCardParsing;
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration;
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+    };
+
+    static size_t ComputeHash(const std::string& jsonString, const ParseSettings& settings);
+    std::list<Entry>::iterator Find(size_t hash, const std::string& jsonString, const ParseSettings& settings);
+    void EvictToFit(size_t maxSizeInBytes);
+
+    mutable std::mutex m_mutex;
+
+    // Most recently used first
+    std::list<Entry> m_entries;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_entriesByHash;
+
+    // Used by the overload without a context. These are the shared default registrations, so those parses can hit
+    // parses made with a default ParseContext.
+    const std::shared_ptr<ElementParserRegistration> m_elementParserRegistration;
+    const std::shared_ptr<ActionParserRegistration> m_actionParserRegistration;
+
+    size_t m_maxSizeInBytes;
+    size_t m_sizeInBytes;
+    size_t m_hits;
+    size_t m_misses;
+    size_t m_evictions;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseThreadPool.h"
+#include <atomic>
+
+using namespace AdaptiveCards;
+
+// State shared by the threads working on one RunParallel call. Threads claim task indexes until none are left, so
+// a worker that gets to a run late simply finds nothing to do.
+struct ParseThreadPool::ParallelRun
+{
+    ParallelRun(size_t taskCount, const std::function<void(size_t)>& task) :
+        taskCount(taskCount), task(task), nextTask(0), unfinishedTasks(taskCount)
+    {
+    }
+
+    const size_t taskCount;
+    const std::function<void(size_t)> task;
+    std::atomic<size_t> nextTask;
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t unfinishedTasks;
+};
+
+ParseThreadPool::ParseThreadPool(unsigned int threadCount) : m_stopping(false)
+{
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        m_workers.emplace_back([this]() { RunWorker(); });
+    }
+}
+
+ParseThreadPool::~ParseThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int ParseThreadPool::GetThreadCount() const
+{
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+void ParseThreadPool::RunParallel(size_t taskCount, const std::function<void(size_t)>& task)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    auto run = std::make_shared<ParallelRun>(taskCount, task);
+
+    // One entry per worker that could usefully help; the caller takes a share of the tasks itself
+    const size_t helperCount = std::min(taskCount - 1, m_workers.size());
+    if (helperCount > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.insert(m_queue.end(), helperCount, run);
+        }
+        m_workAvailable.notify_all();
+    }
+
+    RunTasks(*run);
+
+    std::unique_lock<std::mutex> lock(run->mutex);
+    run->finished.wait(lock, [&run]() { return run->unfinishedTasks == 0; });
+}
+
+void ParseThreadPool::RunWorker()
+{
+    while (true)
+    {
+        std::shared_ptr<ParallelRun> run;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+            if (m_stopping)
+            {
+                return;
+            }
+
+            run = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        RunTasks(*run);
+    }
+}
+
+void ParseThreadPool::RunTasks(ParallelRun& run)
+{
+    size_t completedTasks = 0;
+    for (size_t i = run.nextTask++; i < run.taskCount; i = run.nextTask++)
+    {
+        run.task(i);
+        ++completedTasks;
+    }
+
+    if (completedTasks > 0)
+    {
+        std::lock_guard<std::mutex> lock(run.mutex);
+        run.unfinishedTasks -= completedTasks;
+        if (run.unfinishedTasks == 0)
+        {
+            run.finished.notify_all();
+        }
+    }
+}
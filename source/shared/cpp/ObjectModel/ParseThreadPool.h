@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace AdaptiveCards
+{
+// Fixed size pool of worker threads for parsing parts of a card in parallel (see ParseContext::SetParseThreadPool).
+//
+// Work is handed out fork-join style: RunParallel blocks until every task has run, and the calling thread runs tasks
+// too rather than just waiting. That means a pool of N threads has N - 1 workers, a pool of 1 thread runs everything
+// on the caller, and a task can itself call RunParallel without ever waiting on a task that no thread will pick up.
+class ParseThreadPool
+{
+public:
+    explicit ParseThreadPool(unsigned int threadCount);
+    ~ParseThreadPool();
+
+    ParseThreadPool(const ParseThreadPool&) = delete;
+    ParseThreadPool& operator=(const ParseThreadPool&) = delete;
+
+    // Number of threads that run tasks, counting the caller of RunParallel
+    unsigned int GetThreadCount() const;
+
+    // Calls task(i) for every i in [0, taskCount) and returns once they have all finished. Tasks must not throw.
+    void RunParallel(size_t taskCount, const std::function<void(size_t)>& task);
+
+private:
+    struct ParallelRun;
+
+    void RunWorker();
+    static void RunTasks(ParallelRun& run);
+
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::deque<std::shared_ptr<ParallelRun>> m_queue;
+    bool m_stopping;
+    std::vector<std::thread> m_workers;
+};
+} // namespace AdaptiveCards
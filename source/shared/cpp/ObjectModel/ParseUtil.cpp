@@ -4,35 +4,22 @@
 #include "ParseUtil.h"
 #include "AdaptiveCardParseException.h"
 #include "ElementParserRegistration.h"
+#include "JsonWriter.h"
 #include "ActionParserRegistration.h"
 #include "TextBlock.h"
 #include "Container.h"
 #include "ShowCardAction.h"
 #include "ValueChangedAction.h"
 
-namespace
-{
-Json::StreamWriterBuilder CreateJsonStreamWriter()
-{
-    Json::StreamWriterBuilder builder;
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-
-    return builder;
-}
-} // namespace
-
 namespace AdaptiveCards
 {
 std::string ParseUtil::JsonToString(const Json::Value& json)
 {
-    const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-
-    std::ostringstream outStream;
-    writer->write(json, &outStream);
-    outStream << std::endl;
-    return outStream.str();
+    JsonWriter writer;
+    writer.Write(json);
+    std::string output = writer.TakeOutput();
+    output.push_back('\n');
+    return output;
 }
 
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -43,11 +30,35 @@ void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
     }
 }
 
+const Json::Value* ParseUtil::FindMember(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    return FindMember(json, AdaptiveCardSchemaKeyToString(key));
+}
+
+const Json::Value* ParseUtil::FindMember(const Json::Value& json, const std::string& propertyName)
+{
+    // Json::Value::find hands back a pointer into the existing tree, unlike Json::Value::get which returns a deep
+    // copy of the subtree. Like get, it throws if json is neither an object nor null.
+    return json.find(propertyName.data(), propertyName.data() + propertyName.size());
+}
+
+const Json::Value& ParseUtil::GetMember(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    return GetMember(json, AdaptiveCardSchemaKeyToString(key));
+}
+
+const Json::Value& ParseUtil::GetMember(const Json::Value& json, const std::string& propertyName)
+{
+    const Json::Value* propertyValue = FindMember(json, propertyName);
+    return propertyValue ? *propertyValue : Json::Value::nullSingleton();
+}
+
 std::string ParseUtil::GetTypeAsString(const Json::Value& json)
 {
     const char typeKey[] = "type";
 
-    if (!json.isMember(typeKey))
+    const Json::Value* typeValue = json.find(typeKey, typeKey + sizeof(typeKey) - 1);
+    if (typeValue == nullptr)
     {
         std::stringstream ss;
 
@@ -57,7 +68,7 @@ std::string ParseUtil::GetTypeAsString(const Json::Value& json)
         throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return typeValue->asString();
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -88,7 +99,7 @@ std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaK
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -127,7 +138,7 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -148,7 +159,7 @@ std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchema
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -195,7 +206,7 @@ bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool
 std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -214,7 +225,7 @@ std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, Adaptive
 unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -257,7 +268,7 @@ int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int de
 std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -292,7 +303,7 @@ double ParseUtil:: GetDouble(const Json::Value& json, AdaptiveCardSchemaKey key,
 std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -311,7 +322,7 @@ std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, Adap
 std::optional<std::string> ParseUtil::GetOptionalString(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -352,19 +363,23 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
         throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "null expectedKey");
     }
 
-    if (!json.isMember(expectedKey))
+    const Json::Value* value = json.find(expectedKey, expectedKey + strlen(expectedKey));
+    if (value == nullptr)
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(*value);
 }
 
-std::unordered_map<std::string, Json::Value> ParseUtil::GetJsonMap(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired) {
+namespace
+{
+// Validates the map at key and returns a borrowed reference to it (null if absent and not required).
+const Json::Value& GetMapValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+{
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    Json::Value mapValue = json.get(propertyName, Json::Value());
+    const Json::Value& mapValue = ParseUtil::GetMember(json, propertyName);
 
     if (!mapValue.isNull() && !mapValue.isObject()) {
         throw AdaptiveCardParseException(
@@ -378,11 +393,18 @@ std::unordered_map<std::string, Json::Value> ParseUtil::GetJsonMap(const Json::V
                 "Could not parse required key: " + propertyName + ". It was not found");
     }
 
+    return mapValue;
+}
+} // namespace
+
+std::unordered_map<std::string, Json::Value> ParseUtil::GetJsonMap(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired) {
+    const Json::Value& mapValue = GetMapValue(json, key, isRequired);
+
     std::unordered_map<std::string, Json::Value> result;
 
     if (!mapValue.isNull()) {
-        for (const auto& key : mapValue.getMemberNames()) {
-            result[key] = mapValue[key]; // No type restriction here
+        for (auto it = mapValue.begin(); it != mapValue.end(); ++it) {
+            result.emplace(it.name(), *it); // No type restriction here
         }
     }
 
@@ -394,24 +416,25 @@ std::unordered_map<std::string, std::string> ParseUtil::GetStringMap(
         AdaptiveCardSchemaKey key,
         bool isRequired,
         bool lowerCaseKeys) {
-    std::unordered_map<std::string, Json::Value> valueMap = ParseUtil::GetJsonMap(json, key, isRequired);
+    const Json::Value& mapValue = GetMapValue(json, key, isRequired);
     std::unordered_map<std::string, std::string> stringMap;
 
-    for (const auto& pair : valueMap) {
-        if (!pair.second.isString()) {
+    for (auto it = mapValue.begin(); it != mapValue.end(); ++it) {
+        const std::string name = it.name();
+        if (!it->isString()) {
             throw AdaptiveCardParseException(
                     ErrorStatusCode::InvalidPropertyValue,
-                    "Value for key \"" + pair.first + "\" is not a string.");
+                    "Value for key \"" + name + "\" is not a string.");
         }
-        stringMap[lowerCaseKeys ? ToLowercase(pair.first) : pair.first] = pair.second.asString();
+        stringMap[lowerCaseKeys ? ToLowercase(name) : name] = it->asString();
     }
     return stringMap;
 }
 
-Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    const Json::Value& elementArray = GetMember(json, propertyName);
 
     if (!elementArray.isNull() && !elementArray.isArray())
     {
@@ -432,7 +455,7 @@ Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey k
 
 std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+    const Json::Value& jsonArray = ParseUtil::GetArray(json, key, isRequired);
     std::vector<std::string> strings;
 
     strings.reserve(jsonArray.size());
@@ -447,12 +470,18 @@ std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, Adap
 
 Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
 {
-    const thread_local Json::CharReaderBuilder readerBuilder;
-    std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
+    return GetJsonValueFromBuffer(jsonString.data(), jsonString.size());
+}
+
+Json::Value ParseUtil::GetJsonValueFromBuffer(const char* data, size_t length)
+{
+    // Each thread keeps one reader rather than building a new one per card. A reader resets its state at the start
+    // of every parse.
+    thread_local const std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 
     Json::Value jsonValue;
     std::string errors;
-    if (!reader->parse(jsonString.data(), jsonString.data() + jsonString.size(), &jsonValue, &errors))
+    if (!reader->parse(data, data + length, &jsonValue, &errors))
     {
         std::ostringstream exceptionMsg{};
         exceptionMsg << "Expected JSON Object (" << errors << ")";
@@ -462,10 +491,10 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     return jsonValue;
 }
 
-Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = GetMember(json, propertyName);
     if (isRequired && propertyValue.empty())
     {
         throw AdaptiveCardParseException(
@@ -482,6 +511,93 @@ std::string ParseUtil::ToLowercase(std::string const& value)
     return new_value;
 }
 
+ContainerBleedDirection ParseUtil::GetCollectionItemBleedDirection(
+    bool isTopToBottomContainer, ContainerBleedDirection parentBleedDirection, size_t index, size_t count)
+{
+    ContainerBleedDirection currentBleedState = parentBleedDirection;
+
+    if (index != 0)
+    {
+        // In a top to bottom container (Container, Column) only the first item can bleed up, in a left
+        // to right container (ColumnSet) only the first item can bleed left. If we're not the first item,
+        // turn off the relevant bit.
+        currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedUp : ~ContainerBleedDirection::BleedLeft;
+    }
+
+    if (index != (count - 1))
+    {
+        // In a top to bottom container (Container, Column) only the last item can bleed down, in a left
+        // to right container (ColumnSet) only the last item can bleed right. If we're not the last item,
+        // turn off the relevant bit.
+        currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedDown : ~ContainerBleedDirection::BleedRight;
+    }
+
+    return currentBleedState;
+}
+
+namespace
+{
+// A collection is only split if every run gets at least this many items
+constexpr size_t c_minItemsPerParallelRun = 8;
+
+// More runs than threads evens out runs that take longer than others
+constexpr size_t c_parallelRunsPerThread = 4;
+
+bool ContainsMember(const Json::Value& json, const std::string& propertyName)
+{
+    if (json.isObject())
+    {
+        if (json.isMember(propertyName))
+        {
+            return true;
+        }
+        for (const auto& member : json)
+        {
+            if (ContainsMember(member, propertyName))
+            {
+                return true;
+            }
+        }
+    }
+    else if (json.isArray())
+    {
+        for (const auto& element : json)
+        {
+            if (ContainsMember(element, propertyName))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+} // namespace
+
+size_t ParseUtil::GetParallelRunCount(const ParseContext& context, const Json::Value& itemArray)
+{
+    const auto& threadPool = context.GetParseThreadPool();
+    if (!threadPool || threadPool->GetThreadCount() < 2 || itemArray.size() < 2 * c_minItemsPerParallelRun)
+    {
+        return 0;
+    }
+
+    // Deferred ShowCard parses hold on to the ID list of the context that parsed the action, which for a fork is
+    // not the one the rest of the card's IDs end up in
+    if (context.GetDeferShowCardParsing())
+    {
+        return 0;
+    }
+
+    // Labels declared with "labelFor" go into a process wide map as they are parsed and are read back by the inputs
+    // parsed after them, so those have to be parsed in document order
+    if (ContainsMember(itemArray, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::LabelFor)))
+    {
+        return 0;
+    }
+
+    return std::min<size_t>(itemArray.size() / c_minItemsPerParallelRun, threadPool->GetThreadCount() * c_parallelRunsPerThread);
+}
+
 std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContext& context, const Json::Value& json)
 {
     if (json.empty() || !json.isObject())
@@ -493,26 +609,20 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
     // Get the element's type
     std::string typeString = GetTypeAsString(json);
 
-    auto parser = context.actionParserRegistration->GetParser(typeString);
-    if (parser == nullptr)
-    {
-        parser = context.actionParserRegistration->GetParser("UnknownAction");
-    }
-
     // Parse it if it's allowed by the current parsers
-    if (parser != nullptr)
+    std::shared_ptr<BaseActionElement> action;
+    if (!context.actionParserRegistration->TryDeserialize(context, typeString, json, action))
     {
-        // Use the parser that maps to the type
-        return parser->Deserialize(context, json);
+        context.actionParserRegistration->TryDeserialize(context, ActionTypeToString(ActionType::UnknownAction), json, action);
     }
 
-    return nullptr;
+    return action;
 }
 
 std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -537,7 +647,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
 std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const Json::Value& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
     if (!selectAction.empty())
     {
@@ -565,21 +675,15 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
             ErrorStatusCode::InvalidPropertyValue, "Element type is not a string, TextBlock or RichTextBlock");
     }
 
-    auto parser = context.elementParserRegistration->GetParser(typeString);
-
     // Parse it if it's allowed by the current parsers
-    if (parser != nullptr)
-    {
-        // Use the parser that maps to the type
-        return parser->Deserialize(context, json);
-    }
-
-    return nullptr;
+    std::shared_ptr<BaseCardElement> label;
+    context.elementParserRegistration->TryDeserialize(context, typeString, json, label);
+    return label;
 }
 
 std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    auto label = ParseUtil::ExtractJsonValue(json, key);
+    const Json::Value& label = ParseUtil::ExtractJsonValue(json, key);
 
     if (!label.empty())
     {
@@ -591,7 +695,7 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, cons
 
 void ParseUtil::ParseRequires(ParseContext& /*context*/, const Json::Value& json, std::unordered_map<std::string, AdaptiveCards::SemanticVersion>& requiresSet)
 {
-    const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+    const Json::Value& requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
     return ParseUtil::GetParsedRequiresSet(requiresValue, requiresSet);
 }
 
@@ -601,12 +705,10 @@ void ParseUtil::GetParsedRequiresSet(const Json::Value& json, std::unordered_map
     {
         if (json.isObject())
         {
-            const auto& memberNames = json.getMemberNames();
-            const auto countNames = memberNames.size();
-            for (unsigned int i = 0; i < countNames; ++i)
+            for (auto it = json.begin(); it != json.end(); ++it)
             {
-                const auto& memberName = memberNames.at(i);
-                const auto& memberValue = json[memberName].asString();
+                const std::string memberName = it.name();
+                const std::string memberValue = it->asString();
 
                 if (memberValue == "*")
                 {
@@ -6,6 +6,7 @@
 #include "AdaptiveCardParseException.h"
 #include "BackgroundImage.h"
 #include "ParseContext.h"
+#include "ParseThreadPool.h"
 
 namespace AdaptiveCards
 {
@@ -24,6 +25,15 @@ namespace ParseUtil
 
     void ThrowIfNotJsonObject(const Json::Value& json);
 
+    // Returns a borrowed pointer to the value mapped to key, or nullptr if the key is not present. The returned
+    // pointer is only valid for as long as json is alive and unmodified.
+    const Json::Value* FindMember(const Json::Value& json, AdaptiveCardSchemaKey key);
+    const Json::Value* FindMember(const Json::Value& json, const std::string& propertyName);
+
+    // Returns a borrowed reference to the value mapped to key, or to a shared null value if the key is not present.
+    const Json::Value& GetMember(const Json::Value& json, AdaptiveCardSchemaKey key);
+    const Json::Value& GetMember(const Json::Value& json, const std::string& propertyName);
+
     std::string GetTypeAsString(const Json::Value& json);
 
     std::string TryGetTypeAsString(const Json::Value& json);
@@ -57,15 +67,17 @@ namespace ParseUtil
 
     std::optional<std::string> GetOptionalString(const Json::Value& json, AdaptiveCardSchemaKey key);
 
-    Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+    const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     Json::Value GetJsonValueFromString(const std::string& jsonString);
 
+    Json::Value GetJsonValueFromBuffer(const char* data, size_t length);
+
     std::shared_ptr<ValueChangedAction> GetValueChangedAction(const Json::Value& json);
 
-    Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+    const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     template <typename T, typename Fn>
     std::optional<T> GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter);
@@ -90,6 +102,19 @@ namespace ParseUtil
     template <typename T>
     std::shared_ptr<T> GetElementOfType(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, DeserializeFn<T>& deserializer);
 
+    template <typename T>
+    using CollectionItemParser = const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value& item, size_t index)>;
+
+    // Parses every item of a collection, in order. When the context has a thread pool and the collection is large
+    // enough, runs of sibling items are parsed in parallel, each on its own fork of the context. If the forks can't
+    // be joined back exactly (see ParseContext::JoinParallelParse) or any of them throws, the collection is parsed
+    // again serially, so the result or exception is always that of a serial parse.
+    template <typename T>
+    std::vector<std::shared_ptr<T>> ParseCollectionItems(ParseContext& context, const Json::Value& itemArray, CollectionItemParser<T>& parseItem);
+
+    // Returns how many runs to split a collection into for ParseCollectionItems, or 0 to parse it serially
+    size_t GetParallelRunCount(const ParseContext& context, const Json::Value& itemArray);
+
     template <typename T>
     std::vector<std::shared_ptr<T>> GetElementCollection(
         bool isTopToBottomContainer,
@@ -99,6 +124,10 @@ namespace ParseUtil
         bool isRequired = false,
         const std::string& impliedType = std::string());
 
+    // Returns the bleed direction allowed for the item at index in a collection of count items
+    ContainerBleedDirection GetCollectionItemBleedDirection(
+        bool isTopToBottomContainer, ContainerBleedDirection parentBleedDirection, size_t index, size_t count);
+
     template <typename T>
     std::vector<std::shared_ptr<T>> GetElementCollectionOfSingleType(
         ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, DeserializeFn<T>& deserializer, bool isRequired = false);
@@ -152,7 +181,7 @@ namespace ParseUtil
             DeserializeFn<T>& deserializer,
             bool isRequired = false) {
         const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        Json::Value mapValue = json.get(propertyName, Json::Value());
+        const Json::Value& mapValue = GetMember(json, propertyName);
 
         if (!mapValue.isNull() && !mapValue.isObject()) {
             throw AdaptiveCardParseException(
@@ -169,8 +198,8 @@ namespace ParseUtil
         std::unordered_map<std::string, std::shared_ptr<T>> result;
 
         if (!mapValue.isNull()) {
-            for (const auto& key : mapValue.getMemberNames()) {
-                result[key] = deserializer(context, mapValue[key]);
+            for (auto it = mapValue.begin(); it != mapValue.end(); ++it) {
+                result[it.name()] = deserializer(context, *it);
             }
         }
 
@@ -185,8 +214,7 @@ std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, Adapti
     std::string propertyValueStr = "";
     try
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto const& propertyValue = json.get(propertyName, Json::Value());
+        const Json::Value& propertyValue = GetMember(json, key);
         if (propertyValue.empty())
         {
             return std::nullopt;
@@ -263,27 +291,20 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
-    std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
     {
-        return elements;
+        return {};
     }
 
-    elements.reserve(elementArray.size());
-
     // Deserialize every element in the array
-    for (const Json::Value& curJsonValue : elementArray)
-    {
-        // Parse the element
-        auto el = deserializer(context, curJsonValue);
-        if (el != nullptr)
-        {
-            elements.push_back(el);
-        }
-    }
+    auto elements = ParseCollectionItems<T>(
+        context, elementArray, [&deserializer](ParseContext& itemContext, const Json::Value& curJsonValue, size_t) {
+            return deserializer(itemContext, curJsonValue);
+        });
 
+    elements.erase(std::remove(elements.begin(), elements.end(), nullptr), elements.end());
     return elements;
 }
 
@@ -297,7 +318,7 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     T result = defaultValue;
     try
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const Json::Value& jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
         if (!jsonObject.empty())
         {
             result = deserializer(jsonObject, defaultValue);
@@ -321,77 +342,103 @@ static void ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Va
     T::ParseJsonObject(context, json, baseElement);
 }
 
+template <typename T>
+std::vector<std::shared_ptr<T>> ParseUtil::ParseCollectionItems(ParseContext& context, const Json::Value& itemArray, CollectionItemParser<T>& parseItem)
+{
+    const size_t itemCount = itemArray.size();
+    std::vector<std::shared_ptr<T>> items(itemCount);
+
+    if (const size_t runCount = GetParallelRunCount(context, itemArray); runCount > 1)
+    {
+        std::vector<ParseContext> forks;
+        forks.reserve(runCount);
+        for (size_t run = 0; run < runCount; ++run)
+        {
+            forks.push_back(context.ForkForParallelParse());
+        }
+
+        // One flag per run rather than a shared one, so that runs never write to the same memory
+        std::vector<char> runFailed(runCount, false);
+        context.GetParseThreadPool()->RunParallel(runCount, [&](size_t run) {
+            try
+            {
+                for (size_t i = run * itemCount / runCount; i < (run + 1) * itemCount / runCount; ++i)
+                {
+                    items[i] = parseItem(forks[run], itemArray[static_cast<Json::ArrayIndex>(i)], i);
+                }
+            }
+            catch (...)
+            {
+                runFailed[run] = true;
+            }
+        });
+
+        if (std::find(runFailed.begin(), runFailed.end(), true) == runFailed.end() && context.JoinParallelParse(forks))
+        {
+            return items;
+        }
+    }
+
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        items[i] = parseItem(context, itemArray[static_cast<Json::ArrayIndex>(i)], i);
+    }
+    return items;
+}
+
 template <typename T>
 std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
-    std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
     {
-        return elements;
+        return {};
     }
 
     const size_t elemSize = elementArray.size();
-    elements.reserve(elemSize);
-
     const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
-    size_t currentIndex = 0;
-    for (auto& curJsonValue : elementArray)
-    {
-        ContainerBleedDirection currentBleedState = previousBleedState;
+    return ParseCollectionItems<T>(context, elementArray, [&](ParseContext& itemContext, const Json::Value& curJsonValue, size_t currentIndex) {
+        itemContext.PushBleedDirection(GetCollectionItemBleedDirection(isTopToBottomContainer, previousBleedState, currentIndex, elemSize));
 
-        if (currentIndex != 0)
-        {
-            // In a top to bottom container (Container, Column) only the first item can bleed up, in a left
-            // to right container (ColumnSet) only the first item can bleed left. If we're not the first item,
-            // turn off the relevant bit.
-            currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedUp : ~ContainerBleedDirection::BleedLeft;
-        }
-
-        if (currentIndex != (elemSize - 1))
-        {
-            // In a top to bottom container (Container, Column) only the last item can bleed down, in a left
-            // to right container (ColumnSet) only the last item can bleed right. If we're not the last item,
-            // turn off the relevant bit.
-            currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedDown : ~ContainerBleedDirection::BleedRight;
-        }
-
-        context.PushBleedDirection(currentBleedState);
+        std::shared_ptr<BaseElement> curElement;
 
         // If all items in this collection have the same implied type (i.e. Columns), verify
         // that if set it is set correctly and set it if it isn't
-        if (!impliedType.empty())
+        const std::string typeString =
+            impliedType.empty() ? impliedType : ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, false);
+        if (!impliedType.empty() && typeString.empty())
+        {
+            // Only an element that omits its type needs its own copy to carry the implied type; everything
+            // else is parsed in place.
+            Json::Value typedJsonValue = curJsonValue;
+            typedJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+            ParseJsonObject<T>(itemContext, typedJsonValue, curElement);
+        }
+        else
         {
-            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
             if (typeString.compare(impliedType) != 0)
             {
                 throw AdaptiveCardParseException(
                     ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
             }
 
-            curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
+            ParseJsonObject<T>(itemContext, curJsonValue, curElement);
         }
 
-        std::shared_ptr<BaseElement> curElement;
-        ParseJsonObject<T>(context, curJsonValue, curElement);
-        elements.push_back(std::static_pointer_cast<T>(curElement));
-
         // restores the parent's bleed state
-        context.PopBleedDirection();
+        itemContext.PopBleedDirection();
 
-        currentIndex++;
-    }
-
-    return elements;
+        return std::static_pointer_cast<T>(curElement);
+    });
 }
 
 template <typename T>
 void ParseUtil::ParseFallback(ParseContext& context, const Json::Value& json, FallbackType& fallbackType, std::shared_ptr<BaseElement>& fallbackContent, const std::string& publicId, const InternalId& internalId)
 {
-    const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    const Json::Value& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
     if (!fallbackValue.empty())
     {
         // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <atomic>
+#include <mutex>
+
+namespace AdaptiveCards
+{
+// Table of parsers keyed by type name, shared by ElementParserRegistration and ActionParserRegistration.
+//
+// Names that match a value of TType (case-insensitively) are resolved through that enum's compile-time perfect hash
+// and stored in a slot per value. Any other name goes in a case-insensitive map. Readers never lock: every change
+// publishes a new immutable table and earlier tables are kept until the registry is destroyed, so a parser found by
+// Find stays valid for the lifetime of the registry even if it is later replaced or removed. Registrations are
+// expected to change rarely, usually only while a host is being set up.
+//
+// Tables are immutable and reference counted, so registries can start out sharing one table (such as the built-in
+// parsers) and only copy it when they are first changed.
+template <typename TParser, typename TType>
+class ParserRegistry
+{
+public:
+    struct Table
+    {
+        std::vector<std::shared_ptr<TParser>> typeParsers; // indexed by TType
+        std::unordered_map<std::string, std::shared_ptr<TParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> otherParsers;
+    };
+
+    static std::shared_ptr<const Table> MakeTable(const EnumHelpers::EnumMapping<TType>& types,
+                                                  std::initializer_list<std::pair<TType, std::shared_ptr<TParser>>> parsers)
+    {
+        auto table = std::make_shared<Table>();
+        const auto values = types.values();
+        table->typeParsers.resize(values.empty() ? 0 : static_cast<size_t>(values.back()) + 1);
+        for (const auto& parser : parsers)
+        {
+            table->typeParsers[static_cast<size_t>(parser.first)] = parser.second;
+        }
+        return table;
+    }
+
+    ParserRegistry(const EnumHelpers::EnumMapping<TType>& types, std::shared_ptr<const Table> table) :
+        m_types(types), m_current(table.get()), m_initialTable(std::move(table))
+    {
+    }
+
+    ParserRegistry(const ParserRegistry&) = delete;
+    ParserRegistry(ParserRegistry&&) = delete;
+    ParserRegistry& operator=(const ParserRegistry&) = delete;
+    ParserRegistry& operator=(ParserRegistry&&) = delete;
+    ~ParserRegistry() = default;
+
+    // Returns the parser registered for type, or nullptr. Doesn't lock or allocate.
+    TParser* Find(const std::string& type) const
+    {
+        const auto parser = FindEntry(*m_current.load(std::memory_order_acquire), type);
+        return parser ? parser->get() : nullptr;
+    }
+
+    // As above, and sets isInitial if the parser is one the registry was created with (such as a built-in parser)
+    // rather than one registered through Set
+    TParser* Find(const std::string& type, bool& isInitial) const
+    {
+        const Table& table = *m_current.load(std::memory_order_acquire);
+        if (const TType* value = m_types.find(type))
+        {
+            TParser* parser = table.typeParsers[static_cast<size_t>(*value)].get();
+            isInitial = parser && (parser == m_initialTable->typeParsers[static_cast<size_t>(*value)].get());
+            return parser;
+        }
+
+        isInitial = false;
+        const auto parser = FindEntry(table, type);
+        return parser ? parser->get() : nullptr;
+    }
+
+    std::shared_ptr<TParser> Get(const std::string& type) const
+    {
+        const auto parser = FindEntry(*m_current.load(std::memory_order_acquire), type);
+        return parser ? *parser : nullptr;
+    }
+
+    // Registers parser for type, or removes the registration if parser is null
+    void Set(const std::string& type, std::shared_ptr<TParser> parser)
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        auto table = std::make_shared<Table>(*m_current.load(std::memory_order_relaxed));
+        if (const TType* value = m_types.find(type))
+        {
+            table->typeParsers[static_cast<size_t>(*value)] = std::move(parser);
+        }
+        else if (parser)
+        {
+            table->otherParsers[type] = std::move(parser);
+        }
+        else
+        {
+            table->otherParsers.erase(type);
+        }
+        Publish(std::move(table));
+    }
+
+private:
+    const std::shared_ptr<TParser>* FindEntry(const Table& table, const std::string& type) const
+    {
+        if (const TType* value = m_types.find(type))
+        {
+            const auto& parser = table.typeParsers[static_cast<size_t>(*value)];
+            return parser ? &parser : nullptr;
+        }
+
+        if (table.otherParsers.empty())
+        {
+            return nullptr;
+        }
+        const auto parser = table.otherParsers.find(type);
+        return (parser != table.otherParsers.end()) ? &parser->second : nullptr;
+    }
+
+    // Called with m_writeMutex held
+    void Publish(std::shared_ptr<const Table> table)
+    {
+        m_current.store(table.get(), std::memory_order_release);
+        m_tables.push_back(std::move(table));
+    }
+
+    const EnumHelpers::EnumMapping<TType>& m_types;
+    std::atomic<const Table*> m_current{nullptr};
+    std::mutex m_writeMutex;
+    std::shared_ptr<const Table> m_initialTable;
+    std::vector<std::shared_ptr<const Table>> m_tables; // every table published since m_initialTable
+};
+} // namespace AdaptiveCards
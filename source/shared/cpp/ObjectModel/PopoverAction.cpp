@@ -26,11 +26,15 @@ Json::Value PopoverAction::SerializeToJsonValue() const {
     return root;
 }
 
-void PopoverAction::PopulateKnownPropertiesSet() {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Content)});
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::DisplayArrow)});
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxPopoverWidth)});
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Position)});
+void PopoverAction::PopulateKnownPropertiesSet()
+{
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Content,
+         AdaptiveCardSchemaKey::DisplayArrow,
+         AdaptiveCardSchemaKey::MaxPopoverWidth,
+         AdaptiveCardSchemaKey::Position});
+    m_knownProperties = &knownProperties;
 }
 
 const std::shared_ptr<BaseCardElement> PopoverAction::GetContent() const {
@@ -52,7 +56,7 @@ const LabelPosition PopoverAction::GetPosition() const {
 std::shared_ptr<BaseActionElement> PopoverActionParser::Deserialize(ParseContext& context, const Json::Value& json) {
     std::shared_ptr<PopoverAction> action = BaseActionElement::Deserialize<PopoverAction>(context, json);
 
-    auto content = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Content, true);
+    const auto& content = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Content, true);
     std::shared_ptr<BaseElement> curElement;
     ParseJsonObject<BaseCardElement>(context, content, curElement);
     action->m_content = std::static_pointer_cast<BaseCardElement>(curElement);
@@ -21,13 +21,15 @@ ProgressBar::ProgressBar() : BaseCardElement(CardElementType::ProgressBar)
     PopulateKnownPropertiesSet();
 }
 
-void ProgressBar::PopulateKnownPropertiesSet(){
-    m_knownProperties.insert({
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)
-    });
+void ProgressBar::PopulateKnownPropertiesSet()
+{
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Value});
+    m_knownProperties = &knownProperties;
 }
 
 ProgressBarColor ProgressBar::GetColor() const {
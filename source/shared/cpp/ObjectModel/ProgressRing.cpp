@@ -22,13 +22,15 @@ ProgressRing::ProgressRing() : BaseCardElement(CardElementType::ProgressRing)
     PopulateKnownPropertiesSet();
 }
 
-void ProgressRing::PopulateKnownPropertiesSet(){
-    m_knownProperties.insert({
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::LabelPosition),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-    });
+void ProgressRing::PopulateKnownPropertiesSet()
+{
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Label,
+         AdaptiveCardSchemaKey::LabelPosition,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::HorizontalAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 const std::string ProgressRing::GetLabel() const {
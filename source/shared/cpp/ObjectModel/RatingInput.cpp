@@ -116,10 +116,12 @@ std::shared_ptr<BaseCardElement> RatingInputParser::DeserializeFromString(ParseC
 
 void RatingInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-                             {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::HorizontalAlignment});
+    m_knownProperties = &knownProperties;
 }
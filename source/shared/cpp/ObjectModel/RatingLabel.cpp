@@ -150,11 +150,13 @@ std::shared_ptr<BaseCardElement> RatingLabelParser::DeserializeFromString(ParseC
 
 void RatingLabel::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-                             {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Count),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Count,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::HorizontalAlignment});
+    m_knownProperties = &knownProperties;
 }
@@ -90,7 +90,7 @@ std::shared_ptr<References> References::Deserialize(ParseContext& context, const
     references->m_keywords = std::move(keywords);
 
     if (references->m_type == ReferenceType::AdaptiveCard && json.isMember(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Content))) {
-        auto parseResult = AdaptiveCard::Deserialize(json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Content), Json::Value()), "", context);
+        auto parseResult = AdaptiveCard::Deserialize(ParseUtil::GetMember(json, AdaptiveCardSchemaKey::Content), "", context);
         auto showCardWarnings = parseResult->GetWarnings();
         context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
         references->m_content = parseResult->GetAdaptiveCard();
@@ -3,10 +3,11 @@
 #include "pch.h"
 #include "SemanticVersion.h"
 #include "AdaptiveCardParseException.h"
+#include <limits>
 
 using namespace AdaptiveCards;
 
-SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor(0), _build(0), _revision(0)
+SemanticVersion::SemanticVersion(const std::string& version) : _majorMinor(0), _buildRevision(0)
 {
     // valid:
     // "1"
@@ -18,53 +19,52 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // ""
     // "1."
     // "F"
-
-    bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    if (!TryParse(version, *this))
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+    }
+}
 
-        try
-        {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
+bool SemanticVersion::TryParse(std::string_view version, SemanticVersion& result) noexcept
+{
+    // Each part is one or more ASCII digits and must fit in an int, as when the parts were read with std::stoi
+    constexpr unsigned int maxPart = static_cast<unsigned int>(std::numeric_limits<int>::max());
 
-            if (subMatches[2].matched)
+    unsigned int parts[4] = {0, 0, 0, 0};
+    size_t partCount = 0;
+    size_t position = 0;
+    while (true)
+    {
+        const size_t partStart = position;
+        unsigned int part = 0;
+        while (position < version.size() && version[position] >= '0' && version[position] <= '9')
+        {
+            const unsigned int digit = static_cast<unsigned int>(version[position] - '0');
+            if (part > (maxPart - digit) / 10)
             {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
+                return false;
             }
+            part = part * 10 + digit;
+            ++position;
+        }
 
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
+        if (position == partStart)
+        {
+            return false;
+        }
+        parts[partCount++] = part;
 
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
+        if (position == version.size())
+        {
+            break;
         }
-        catch (const std::out_of_range&)
+        if (version[position] != '.' || partCount == 4)
         {
-            versionValid = false;
+            return false;
         }
+        ++position;
     }
 
-    if (!versionValid)
-    {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
-    }
+    result = SemanticVersion(parts[0], parts[1], parts[2], parts[3]);
+    return true;
 }
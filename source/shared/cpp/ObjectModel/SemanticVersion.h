@@ -3,74 +3,66 @@
 #pragma once
 
 #include "pch.h"
+#include <cstdint>
+#include <string_view>
 
 namespace AdaptiveCards
 {
+// A version of one to four dot-separated parts, such as "1.2" or "1.2.3.4". Missing parts are zero.
+//
+// The parts are kept packed into two integers, major and minor in one and build and revision in the other, so that
+// comparing two versions compares two pairs of integers.
 class SemanticVersion
 {
 public:
     SemanticVersion(const std::string& version);
 
+    constexpr SemanticVersion(unsigned int major, unsigned int minor, unsigned int build = 0, unsigned int revision = 0) :
+        _majorMinor((static_cast<std::uint64_t>(major) << 32) | minor),
+        _buildRevision((static_cast<std::uint64_t>(build) << 32) | revision)
+    {
+    }
+
+    // Parses version without throwing or allocating. Returns false, leaving result unchanged, if it isn't valid.
+    static bool TryParse(std::string_view version, SemanticVersion& result) noexcept;
+
     unsigned int GetMajor() const
     {
-        return _major;
+        return static_cast<unsigned int>(_majorMinor >> 32);
     }
     unsigned int GetMinor() const
     {
-        return _minor;
+        return static_cast<unsigned int>(_majorMinor);
     }
     unsigned int GetBuild() const
     {
-        return _build;
+        return static_cast<unsigned int>(_buildRevision >> 32);
     }
     unsigned int GetRevision() const
     {
-        return _revision;
+        return static_cast<unsigned int>(_buildRevision);
     }
 
     operator std::string() const
     {
-        std::stringstream version{};
-        version << _major << '.' << _minor << '.' << _build << '.' << _revision;
-        return version.str();
+        return std::to_string(GetMajor()) + '.' + std::to_string(GetMinor()) + '.' + std::to_string(GetBuild()) + '.' +
+               std::to_string(GetRevision());
     }
 
-private:
-    unsigned int _major;
-    unsigned int _minor;
-    unsigned int _build;
-    unsigned int _revision;
-};
-
-inline bool operator==(const SemanticVersion& lhs, const SemanticVersion& rhs)
-{
-    return lhs.GetMajor() == rhs.GetMajor() && lhs.GetMinor() == rhs.GetMinor() && lhs.GetBuild() == rhs.GetBuild() &&
-           lhs.GetRevision() == rhs.GetRevision();
-}
-
-inline bool operator<(const SemanticVersion& lhs, const SemanticVersion& rhs)
-{
-    if (lhs.GetMajor() != rhs.GetMajor())
+    friend bool operator==(const SemanticVersion& lhs, const SemanticVersion& rhs)
     {
-        return lhs.GetMajor() < rhs.GetMajor();
+        return lhs._majorMinor == rhs._majorMinor && lhs._buildRevision == rhs._buildRevision;
     }
-    else if (lhs.GetMinor() != rhs.GetMinor())
-    {
-        return lhs.GetMinor() < rhs.GetMinor();
-    }
-    else if (lhs.GetBuild() != rhs.GetBuild())
-    {
-        return lhs.GetBuild() < rhs.GetBuild();
-    }
-    else if (lhs.GetRevision() != rhs.GetRevision())
-    {
-        return lhs.GetRevision() < rhs.GetRevision();
-    }
-    else
+
+    friend bool operator<(const SemanticVersion& lhs, const SemanticVersion& rhs)
     {
-        return false;
+        return (lhs._majorMinor != rhs._majorMinor) ? (lhs._majorMinor < rhs._majorMinor) : (lhs._buildRevision < rhs._buildRevision);
     }
-}
+
+private:
+    std::uint64_t _majorMinor;
+    std::uint64_t _buildRevision;
+};
 
 inline bool operator!=(const SemanticVersion& lhs, const SemanticVersion& rhs)
 {
@@ -14,6 +14,9 @@
 #include "AreaGridLayout.h"
 #include "References.h"
 #include "Resources.h"
+#include "CardSnapshot.h"
+#include "MappedFile.h"
+#include "StreamingCardReader.h"
 
 using namespace AdaptiveCards;
 
@@ -174,12 +177,8 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromFile(
 std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromFile(const std::string& jsonFile, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
 {
-    std::ifstream jsonFileStream(jsonFile);
-
-    Json::Value root;
-    jsonFileStream >> root;
-
-    return AdaptiveCard::Deserialize(root, rendererVersion, context);
+    const MappedFile file(jsonFile);
+    return AdaptiveCard::DeserializeFromBuffer(file.GetData(), file.GetSize(), rendererVersion, context);
 }
 
 // Replace all occurrences of ${rs:key} with value from the map
@@ -263,6 +262,14 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
 #else
 std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
+{
+    return AdaptiveCard::Deserialize(json, rendererVersion, context, [&json](ParseContext& context) {
+        return ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+    });
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
+    const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const BodyDeserializer& deserializeBody)
 {
     ParseUtil::ThrowIfNotJsonObject(json);
 
@@ -381,11 +388,11 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     if (MeetsRootRequirements(requiresSet))
     {
         // Parse body
-        auto body = ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+        auto body = deserializeBody(context);
 
         EnsureShowCardVersions(actions, version);
 
-        auto result = std::make_shared<AdaptiveCard>(
+        auto result = context.MakeShared<AdaptiveCard>(
             version, fallbackText, backgroundImage, refresh, authentication, style, speak, language, verticalContentAlignment, height, minHeight, body, actions, requiresSet, fallbackBaseElement, fallbackType);
         result->SetLanguage(language);
         result->SetRtl(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::Rtl));
@@ -395,9 +402,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         // Parse optional selectAction
         result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        Json::Value additionalProperties;
-        HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
-        result->SetAdditionalProperties(additionalProperties);
+        result->m_additionalProperties.Capture(json, *result->m_knownProperties, context.GetSourceDocument());
         result->SetLayouts(layouts);
 
         return std::make_shared<ParseResult>(result, context.warnings);
@@ -415,7 +420,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         std::shared_ptr<BaseCardElement> fallbackCardElement = std::static_pointer_cast<BaseCardElement>(fallbackBaseElement);
         std::vector<std::shared_ptr<BaseCardElement>> fallbackVector = {fallbackCardElement};
 
-        auto result = std::make_shared<AdaptiveCard>(
+        auto result = context.MakeShared<AdaptiveCard>(
             version, fallbackText, backgroundImage, refresh, authentication, style, speak, language, verticalContentAlignment, height, minHeight, fallbackVector, actions);
         result->SetLanguage(language);
         result->SetRtl(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::Rtl));
@@ -426,35 +431,33 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
         result->SetLayouts(layouts);
 
-        Json::Value additionalProperties;
-        HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
-        result->SetAdditionalProperties(additionalProperties);
+        result->m_additionalProperties.Capture(json, *result->m_knownProperties, context.GetSourceDocument());
 
         return std::make_shared<ParseResult>(result, context.warnings);
     }
 }
 
-bool AdaptiveCard::MeetsRootRequirements(std::unordered_map<std::string, AdaptiveCards::SemanticVersion> requiresSet)
+bool AdaptiveCard::MeetsRootRequirements(const std::unordered_map<std::string, AdaptiveCards::SemanticVersion>& requiresSet)
 {
-    std::unordered_map<std::string, AdaptiveCards::SemanticVersion> featuresSupported = GetFeaturesSupported();
-
-    for (const auto &featureToCheck : requiresSet)
+    if (requiresSet.empty())
     {
-        auto foundFeature = featuresSupported.find(ParseUtil::ToLowercase(featureToCheck.first));
+        return true;
+    }
 
-        if (foundFeature == featuresSupported.end())
+    // The same features as GetFeaturesSupported, looked up without lower casing each name
+    static const auto featuresSupported = []() {
+        const auto features = GetFeaturesSupported();
+        return std::unordered_map<std::string, AdaptiveCards::SemanticVersion, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals>(
+            features.begin(), features.end());
+    }();
+
+    for (const auto& featureToCheck : requiresSet)
+    {
+        auto foundFeature = featuresSupported.find(featureToCheck.first);
+        if (foundFeature == featuresSupported.end() || foundFeature->second < featureToCheck.second)
         {
             return false;
         }
-        else
-        {
-            AdaptiveCards::SemanticVersion localFeatureVersion = foundFeature->second;
-            AdaptiveCards::SemanticVersion adaptiveCardVersion = featureToCheck.second;
-            if (localFeatureVersion < adaptiveCardVersion)
-            {
-                return false;
-            }
-        }
     }
     return true;
 }
@@ -477,12 +480,92 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(
 std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
 {
-    return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
+    // The parse owns the document, so elements can refer to their JSON inside it (see ParseContext::GetSourceDocument)
+    const auto document = std::make_shared<const Json::Value>(ParseUtil::GetJsonValueFromString(jsonString));
+    ParseContext::SourceDocumentScope sourceDocument(context, document);
+    return AdaptiveCard::Deserialize(*document, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBuffer(
+    const char* data, size_t length, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBuffer(const char* data, size_t length, const std::string& rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromBuffer(data, length, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBuffer(
+    const char* data, size_t length, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBuffer(
+    const char* data, size_t length, const std::string& rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    const auto document = std::make_shared<const Json::Value>(ParseUtil::GetJsonValueFromBuffer(data, length));
+    ParseContext::SourceDocumentScope sourceDocument(context, document);
+    return AdaptiveCard::Deserialize(*document, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(
+    const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(const std::string& jsonString, const std::string& rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromStringStreaming(jsonString, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(
+    const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    StreamingCardReader reader(jsonString.data(), jsonString.data() + jsonString.size());
+    if (!reader.Read())
+    {
+        // Leave anything the reader can't stream, including malformed JSON, to the DOM path so that errors are
+        // reported exactly as DeserializeFromString reports them.
+        return AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+    }
+
+    return AdaptiveCard::Deserialize(
+        reader.GetCardProperties(), rendererVersion, context, [&reader](ParseContext& context) { return reader.DeserializeBody(context); });
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromSnapshot(
+    const char* data, size_t length, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromSnapshot(const char* data, size_t length, const std::string& rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromSnapshot(data, length, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromSnapshot(
+    const char* data, size_t length, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromSnapshot(
+    const char* data, size_t length, const std::string& rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    return AdaptiveCard::Deserialize(CardSnapshot::Read(data, length), rendererVersion, context);
 }
 
 Json::Value AdaptiveCard::SerializeToJsonValue() const
 {
-    Json::Value root = GetAdditionalProperties();
+    Json::Value root = m_additionalProperties.ToJson();
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
 
     if (!m_version.empty())
@@ -597,6 +680,11 @@ std::string AdaptiveCard::Serialize() const
     return ParseUtil::JsonToString(SerializeToJsonValue());
 }
 
+std::string AdaptiveCard::SerializeToSnapshot() const
+{
+    return CardSnapshot::Write(SerializeToJsonValue());
+}
+
 std::string AdaptiveCard::GetVersion() const
 {
     return m_version;
@@ -785,44 +873,46 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
 
 void AdaptiveCard::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)});
+    static const KnownProperties knownProperties(
+        nullptr,
+        {AdaptiveCardSchemaKey::Type,
+         AdaptiveCardSchemaKey::Version,
+         AdaptiveCardSchemaKey::Body,
+         AdaptiveCardSchemaKey::Actions,
+         AdaptiveCardSchemaKey::FallbackText,
+         AdaptiveCardSchemaKey::BackgroundImage,
+         AdaptiveCardSchemaKey::Refresh,
+         AdaptiveCardSchemaKey::Authentication,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Speak,
+         AdaptiveCardSchemaKey::Language,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::Schema,
+         AdaptiveCardSchemaKey::Requires,
+         AdaptiveCardSchemaKey::Fallback});
+    m_knownProperties = &knownProperties;
 }
 
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    return m_knownProperties->GetNames();
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
 {
-    return m_additionalProperties;
+    return m_additionalProperties.Get();
 }
 
 void AdaptiveCard::SetAdditionalProperties(Json::Value&& value)
 {
-    m_additionalProperties = std::move(value);
+    m_additionalProperties.Set(std::move(value));
 }
 void AdaptiveCard::SetAdditionalProperties(const Json::Value& value)
 {
-    m_additionalProperties = value;
+    m_additionalProperties.Set(value);
 }
 
 std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
@@ -172,9 +172,25 @@ public:
         const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<ParseResult> DeserializeFromString(
         const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromBuffer(
+        const char* data, size_t length, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromBuffer(
+        const char* data, size_t length, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(
+        const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(
+        const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromSnapshot(
+        const char* data, size_t length, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromSnapshot(
+        const char* data, size_t length, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak) throw(AdaptiveCards::AdaptiveCardParseException);
 #else
+    // Reads the whole file in one go, memory mapping it where the platform allows. See MappedFile.
     static std::shared_ptr<ParseResult> DeserializeFromFile(const std::string& jsonFile, const std::string& rendererVersion, ParseContext& context);
     static std::shared_ptr<ParseResult> DeserializeFromFile(const std::string& jsonFile, const std::string& rendererVersion);
 
@@ -183,6 +199,23 @@ public:
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
 
+    // Parses length bytes of JSON owned by the caller, for hosts that already hold the card in memory. The buffer
+    // doesn't need to be null terminated and is not copied.
+    static std::shared_ptr<ParseResult> DeserializeFromBuffer(
+        const char* data, size_t length, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromBuffer(const char* data, size_t length, const std::string& rendererVersion);
+
+    // Same result as DeserializeFromString, but body elements are read straight from the text one at a time instead
+    // of building a DOM for the whole card first. See StreamingCardReader.
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(
+        const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(const std::string& jsonString, const std::string& rendererVersion);
+
+    // Loads a card saved with SerializeToSnapshot. See CardSnapshot.
+    static std::shared_ptr<ParseResult> DeserializeFromSnapshot(
+        const char* data, size_t length, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromSnapshot(const char* data, size_t length, const std::string& rendererVersion);
+
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak);
 
@@ -190,13 +223,16 @@ public:
     Json::Value SerializeToJsonValue() const;
     std::string Serialize() const;
 
+    // Compact binary form of the card for hosts that cache parsed cards. Load it with DeserializeFromSnapshot.
+    std::string SerializeToSnapshot() const;
+
     const InternalId GetInternalId() const
     {
         return m_internalId;
     }
     // Feature support validation
     static const std::unordered_map<std::string, AdaptiveCards::SemanticVersion> GetFeaturesSupported();
-    static bool MeetsRootRequirements(std::unordered_map<std::string, AdaptiveCards::SemanticVersion> requiresSet);
+    static bool MeetsRootRequirements(const std::unordered_map<std::string, AdaptiveCards::SemanticVersion>& requiresSet);
 
     // Replace all occurrences of ${rs:key} with value from the map
     static std::string ReplaceStringResources(
@@ -206,6 +242,11 @@ public:
     static bool IsStringResourcePresent(const std::string& input);
 
 private:
+    using BodyDeserializer = std::function<std::vector<std::shared_ptr<BaseCardElement>>(ParseContext& context)>;
+
+    static std::shared_ptr<ParseResult> Deserialize(
+        const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const BodyDeserializer& deserializeBody);
+
     static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
     void PopulateKnownPropertiesSet();
 
@@ -222,8 +263,8 @@ private:
     unsigned int m_minHeight;
     std::optional<bool> m_rtl;
     InternalId m_internalId;
-    std::unordered_set<std::string> m_knownProperties;
-    Json::Value m_additionalProperties;
+    const KnownProperties* m_knownProperties;
+    AdditionalProperties m_additionalProperties;
 
     std::vector<std::shared_ptr<Layout>> m_layouts;
 
@@ -5,9 +5,35 @@
 #include "ParseUtil.h"
 #include "ShowCardAction.h"
 #include "ParseContext.h"
+#include <mutex>
 
 using namespace AdaptiveCards;
 
+namespace
+{
+// Deferred cards from one parse share that parse's ID list (see ParseContext::ForkForDeferredParse), so they are
+// parsed one at a time. This also makes it safe to call GetCard() on an action from several threads. The mutex is
+// recursive because parsing a card updates the deferred cards of the ShowCards nested inside it.
+std::recursive_mutex& DeferredCardMutex()
+{
+    static std::recursive_mutex deferredCardMutex;
+    return deferredCardMutex;
+}
+} // namespace
+
+struct ShowCardAction::DeferredCard
+{
+    // The card's JSON, written compactly. Cleared once the card is parsed.
+    std::string cardJson;
+    // The parse state at the point the card was found, which is what an eager parse would have used
+    std::shared_ptr<ParseContext> context;
+    std::string defaultVersion;
+    std::string defaultLanguage;
+
+    std::shared_ptr<AdaptiveCard> card;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+};
+
 ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
 {
     PopulateKnownPropertiesSet();
@@ -24,20 +50,103 @@ Json::Value ShowCardAction::SerializeToJsonValue() const
 
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 {
-    return m_card;
+    if (!m_deferredCard)
+    {
+        return m_card;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+    DeferredCard& deferredCard = *m_deferredCard;
+    if (!deferredCard.card)
+    {
+        auto parseResult =
+            AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(deferredCard.cardJson), "", *deferredCard.context);
+
+        auto card = parseResult->GetAdaptiveCard();
+        if (card->GetVersion().empty())
+        {
+            card->SetVersion(deferredCard.defaultVersion);
+        }
+        if (card->GetLanguage().empty())
+        {
+            card->SetLanguage(deferredCard.defaultLanguage);
+        }
+
+        deferredCard.warnings = parseResult->GetWarnings();
+        deferredCard.card = card;
+
+        deferredCard.cardJson = std::string();
+        deferredCard.context.reset();
+    }
+    return deferredCard.card;
 }
 
 void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
 {
     m_card = card;
+    m_deferredCard.reset();
+}
+
+bool ShowCardAction::IsCardDeferred() const
+{
+    if (!m_deferredCard)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+    return !m_deferredCard->card;
+}
+
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ShowCardAction::GetCardWarnings() const
+{
+    if (!m_deferredCard)
+    {
+        return {};
+    }
+
+    GetCard();
+
+    std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+    return m_deferredCard->warnings;
 }
 
 void ShowCardAction::SetLanguage(const std::string& value)
 {
+    if (m_deferredCard)
+    {
+        std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+        if (!m_deferredCard->card)
+        {
+            m_deferredCard->defaultLanguage = value;
+            return;
+        }
+    }
+
     // If the card inside doesn't specify language, propagate
-    if (m_card->GetLanguage().empty())
+    auto card = GetCard();
+    if (card->GetLanguage().empty())
+    {
+        card->SetLanguage(value);
+    }
+}
+
+void ShowCardAction::SetDefaultCardVersion(const std::string& version)
+{
+    if (m_deferredCard)
+    {
+        std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+        if (!m_deferredCard->card)
+        {
+            m_deferredCard->defaultVersion = version;
+            return;
+        }
+    }
+
+    auto card = GetCard();
+    if (card->GetVersion().empty())
     {
-        m_card->SetLanguage(value);
+        card->SetVersion(version);
     }
 }
 
@@ -45,9 +154,33 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContex
 {
     std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
+    if (context.GetDeferShowCardParsing())
+    {
+        const Json::Value& cardJson = ParseUtil::GetMember(json, AdaptiveCardSchemaKey::Card);
+
+        // Report a card that isn't an Adaptive Card right away, as an eager parse would
+        ParseUtil::ThrowIfNotJsonObject(cardJson);
+        ParseUtil::ExpectTypeString(cardJson, CardElementType::AdaptiveCard);
+
+        auto deferredCard = std::make_shared<ShowCardAction::DeferredCard>();
+        deferredCard->cardJson = ParseUtil::JsonToString(cardJson);
+        deferredCard->context = context.ForkForDeferredParse();
+        showCardAction->m_deferredCard = deferredCard;
+
+        // Parsing the card also changes the language and container style that the rest of the parse sees. Make
+        // the same changes here so that the elements after this action come out as they would in an eager parse.
+        const std::string language = ParseUtil::GetString(cardJson, AdaptiveCardSchemaKey::Language);
+        if (!language.empty())
+        {
+            context.SetLanguage(language);
+        }
+        context.SetParentalContainerStyle(ParseUtil::GetEnumValue<ContainerStyle>(
+            cardJson, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+
+        return showCardAction;
+    }
 
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
+    auto parseResult = AdaptiveCard::Deserialize(ParseUtil::GetMember(json, AdaptiveCardSchemaKey::Card), "", context);
 
     auto showCardWarnings = parseResult->GetWarnings();
     context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
@@ -64,12 +197,26 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::Card});
+    m_knownProperties = &knownProperties;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto card = GetCard();
+    std::shared_ptr<AdaptiveCard> card = m_card;
+    if (m_deferredCard)
+    {
+        std::lock_guard<std::recursive_mutex> lock(DeferredCardMutex());
+        card = m_deferredCard->card;
+        if (!card)
+        {
+            // Give the throwaway parse its own ID list so that it doesn't record the card's IDs against the real parse
+            ParseContext context(*m_deferredCard->context);
+            context.UnshareElementIds();
+            card = AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(m_deferredCard->cardJson), "", context)->GetAdaptiveCard();
+        }
+    }
+
     auto showCardResources = card->GetResourceInformation();
     resourceInfo.insert(resourceInfo.end(), showCardResources.begin(), showCardResources.end());
     return;
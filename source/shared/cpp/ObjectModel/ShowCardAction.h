@@ -21,17 +21,36 @@ public:
 
     Json::Value SerializeToJsonValue() const override;
 
+    // If the card was deferred at parse time (see ParseContext::SetDeferShowCardParsing), the first call parses it.
+    // That parse reports the same ID collisions as an eager parse would have, by throwing AdaptiveCardParseException.
     std::shared_ptr<AdaptiveCards::AdaptiveCard> GetCard() const;
     void SetCard(const std::shared_ptr<AdaptiveCards::AdaptiveCard>);
 
+    // True until a deferred card has been parsed
+    bool IsCardDeferred() const;
+
+    // Warnings from parsing a deferred card (parsing it first if needed). An eagerly parsed card reports its
+    // warnings with the rest of the parse instead, so this is empty for those.
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> GetCardWarnings() const;
+
     void SetLanguage(const std::string& value);
 
+    // Sets the card's version if the card doesn't specify one
+    void SetDefaultCardVersion(const std::string& version);
+
+    // Doesn't parse a deferred card. Its resources are read from a throwaway parse instead.
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
 private:
+    friend class ShowCardActionParser;
+    struct DeferredCard;
+
     void PopulateKnownPropertiesSet();
 
     std::shared_ptr<AdaptiveCard> m_card;
+
+    // Shared between copies of the action so that a deferred card is only parsed once
+    std::shared_ptr<DeferredCard> m_deferredCard;
 };
 
 class ShowCardActionParser : public ActionElementParser
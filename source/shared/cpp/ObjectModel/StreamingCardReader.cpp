@@ -0,0 +1,422 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "StreamingCardReader.h"
+#include "ParseUtil.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// jsoncpp gives up at a nesting depth of 1000. Stay well below that so anything this deep is left to the DOM path,
+// which reports the error the way callers expect.
+constexpr unsigned int c_maxDepth = 900;
+
+bool IsHexDigit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+unsigned int HexValue(const char* hexDigits)
+{
+    unsigned int value = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const char c = hexDigits[i];
+        value = value * 16 + ((c >= '0' && c <= '9') ? (c - '0') : ((c >= 'a' && c <= 'f') ? (c - 'a' + 10) : (c - 'A' + 10)));
+    }
+    return value;
+}
+} // namespace
+
+StreamingCardReader::StreamingCardReader(const char* begin, const char* end) :
+    m_begin(begin), m_end(end), m_cardProperties(Json::objectValue), m_hasBodySlices(false)
+{
+    const thread_local Json::CharReaderBuilder readerBuilder;
+    m_reader.reset(readerBuilder.newCharReader());
+}
+
+bool StreamingCardReader::Read()
+{
+    const char* current = SkipWhitespace(m_begin);
+    if (current == m_end || *current != '{')
+    {
+        return false;
+    }
+
+    current = SkipWhitespace(current + 1);
+    if (current != m_end && *current == '}')
+    {
+        return true;
+    }
+
+    while (current != m_end)
+    {
+        const char* keyBegin = current;
+        const char* keyEnd = SkipString(keyBegin);
+        if (keyEnd == nullptr)
+        {
+            return false;
+        }
+
+        current = SkipWhitespace(keyEnd);
+        if (current == m_end || *current != ':')
+        {
+            return false;
+        }
+
+        const char* valueBegin = SkipWhitespace(current + 1);
+        const char* valueEnd = SkipValue(valueBegin, 1);
+        if (valueEnd == nullptr)
+        {
+            return false;
+        }
+
+        std::string key;
+        if (std::find(keyBegin, keyEnd, '\\') == keyEnd)
+        {
+            key.assign(keyBegin + 1, keyEnd - 1);
+        }
+        else
+        {
+            Json::Value decodedKey;
+            if (!ParseSlice(keyBegin, keyEnd, decodedKey))
+            {
+                return false;
+            }
+            key = decodedKey.asString();
+        }
+
+        const bool isBody = (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body));
+        if (isBody && *valueBegin == '[')
+        {
+            // Record where each element of the body starts and ends. SkipValue has already validated the array, so
+            // this walk only needs to find the element boundaries.
+            m_cardProperties.removeMember(key);
+            m_bodySlices.clear();
+            m_hasBodySlices = true;
+
+            const char* element = SkipWhitespace(valueBegin + 1);
+            while (*element != ']')
+            {
+                const char* elementEnd = SkipValue(element, 2);
+                m_bodySlices.emplace_back(element, elementEnd);
+
+                element = SkipWhitespace(elementEnd);
+                if (*element == ',')
+                {
+                    element = SkipWhitespace(element + 1);
+                }
+            }
+        }
+        else
+        {
+            Json::Value value;
+            if (!ParseSlice(valueBegin, valueEnd, value))
+            {
+                return false;
+            }
+
+            if (isBody)
+            {
+                m_bodySlices.clear();
+                m_hasBodySlices = false;
+            }
+
+            // Like the DOM reader, the last occurrence of a duplicated key wins
+            m_cardProperties[key].swap(value);
+        }
+
+        current = SkipWhitespace(valueEnd);
+        if (current == m_end)
+        {
+            return false;
+        }
+        else if (*current == '}')
+        {
+            // Anything after the closing brace is ignored, matching the DOM reader
+            return true;
+        }
+        else if (*current != ',')
+        {
+            return false;
+        }
+
+        current = SkipWhitespace(current + 1);
+    }
+
+    return false;
+}
+
+const Json::Value& StreamingCardReader::GetCardProperties() const
+{
+    return m_cardProperties;
+}
+
+std::vector<std::shared_ptr<BaseCardElement>> StreamingCardReader::DeserializeBody(ParseContext& context) const
+{
+    if (!m_hasBodySlices)
+    {
+        return ParseUtil::GetElementCollection<BaseCardElement>(true, context, m_cardProperties, AdaptiveCardSchemaKey::Body, false);
+    }
+
+    std::vector<std::shared_ptr<BaseCardElement>> elements;
+    elements.reserve(m_bodySlices.size());
+
+    const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
+    for (size_t currentIndex = 0; currentIndex < m_bodySlices.size(); ++currentIndex)
+    {
+        // Only this element's subtree is materialized, and it is released before the next one is read
+        Json::Value elementJson;
+        if (!ParseSlice(m_bodySlices[currentIndex].first, m_bodySlices[currentIndex].second, elementJson))
+        {
+            ThrowParseError();
+        }
+
+        context.PushBleedDirection(
+            ParseUtil::GetCollectionItemBleedDirection(true, previousBleedState, currentIndex, m_bodySlices.size()));
+
+        std::shared_ptr<BaseElement> curElement;
+        BaseCardElement::ParseJsonObject(context, elementJson, curElement);
+        elements.push_back(std::static_pointer_cast<BaseCardElement>(curElement));
+
+        // restores the parent's bleed state
+        context.PopBleedDirection();
+    }
+
+    return elements;
+}
+
+const char* StreamingCardReader::SkipWhitespace(const char* current) const
+{
+    // Comments are accepted by the DOM reader in some positions but not others, so they are not skipped here and a
+    // card containing them is read through the DOM path instead.
+    while (current != m_end && (*current == ' ' || *current == '\t' || *current == '\r' || *current == '\n'))
+    {
+        ++current;
+    }
+    return current;
+}
+
+const char* StreamingCardReader::SkipString(const char* current) const
+{
+    if (current == m_end || *current != '"')
+    {
+        return nullptr;
+    }
+
+    ++current;
+    while (current != m_end)
+    {
+        const char c = *current++;
+        if (c == '"')
+        {
+            return current;
+        }
+        else if (c == '\\')
+        {
+            if (current == m_end)
+            {
+                return nullptr;
+            }
+
+            const char escape = *current++;
+            if (escape == 'u')
+            {
+                if (m_end - current < 4 || !std::all_of(current, current + 4, IsHexDigit))
+                {
+                    return nullptr;
+                }
+
+                // A high surrogate must be followed by a second \u escape
+                const unsigned int codeUnit = HexValue(current);
+                current += 4;
+                if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF)
+                {
+                    if (m_end - current < 6 || current[0] != '\\' || current[1] != 'u' ||
+                        !std::all_of(current + 2, current + 6, IsHexDigit))
+                    {
+                        return nullptr;
+                    }
+                    current += 6;
+                }
+            }
+            else if (escape != '"' && escape != '\\' && escape != '/' && escape != 'b' && escape != 'f' && escape != 'n' &&
+                     escape != 'r' && escape != 't')
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+const char* StreamingCardReader::SkipNumber(const char* current) const
+{
+    if (current != m_end && *current == '-')
+    {
+        ++current;
+    }
+
+    if (current == m_end || !IsDigit(*current))
+    {
+        return nullptr;
+    }
+
+    if (*current == '0')
+    {
+        ++current;
+    }
+    else
+    {
+        current = std::find_if_not(current, m_end, IsDigit);
+    }
+
+    if (current != m_end && *current == '.')
+    {
+        ++current;
+        if (current == m_end || !IsDigit(*current))
+        {
+            return nullptr;
+        }
+        current = std::find_if_not(current, m_end, IsDigit);
+    }
+
+    if (current != m_end && (*current == 'e' || *current == 'E'))
+    {
+        ++current;
+        if (current != m_end && (*current == '+' || *current == '-'))
+        {
+            ++current;
+        }
+        if (current == m_end || !IsDigit(*current))
+        {
+            return nullptr;
+        }
+        current = std::find_if_not(current, m_end, IsDigit);
+    }
+
+    return current;
+}
+
+const char* StreamingCardReader::SkipLiteral(const char* current, const char* literal) const
+{
+    const size_t length = strlen(literal);
+    if (static_cast<size_t>(m_end - current) < length || !std::equal(literal, literal + length, current))
+    {
+        return nullptr;
+    }
+    return current + length;
+}
+
+const char* StreamingCardReader::SkipValue(const char* current, unsigned int depth) const
+{
+    if (current == m_end || depth > c_maxDepth)
+    {
+        return nullptr;
+    }
+
+    switch (*current)
+    {
+    case '"':
+        return SkipString(current);
+    case 't':
+        return SkipLiteral(current, "true");
+    case 'f':
+        return SkipLiteral(current, "false");
+    case 'n':
+        return SkipLiteral(current, "null");
+    case '[':
+    {
+        current = SkipWhitespace(current + 1);
+        if (current != m_end && *current == ']')
+        {
+            return current + 1;
+        }
+
+        while (current != m_end)
+        {
+            current = SkipValue(current, depth + 1);
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+
+            current = SkipWhitespace(current);
+            if (current != m_end && *current == ']')
+            {
+                return current + 1;
+            }
+            else if (current == m_end || *current != ',')
+            {
+                return nullptr;
+            }
+            current = SkipWhitespace(current + 1);
+        }
+        return nullptr;
+    }
+    case '{':
+    {
+        current = SkipWhitespace(current + 1);
+        if (current != m_end && *current == '}')
+        {
+            return current + 1;
+        }
+
+        while (current != m_end)
+        {
+            current = SkipString(current);
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+
+            current = SkipWhitespace(current);
+            if (current == m_end || *current != ':')
+            {
+                return nullptr;
+            }
+
+            current = SkipValue(SkipWhitespace(current + 1), depth + 1);
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+
+            current = SkipWhitespace(current);
+            if (current != m_end && *current == '}')
+            {
+                return current + 1;
+            }
+            else if (current == m_end || *current != ',')
+            {
+                return nullptr;
+            }
+            current = SkipWhitespace(current + 1);
+        }
+        return nullptr;
+    }
+    default:
+        return SkipNumber(current);
+    }
+}
+
+bool StreamingCardReader::ParseSlice(const char* begin, const char* end, Json::Value& value) const
+{
+    std::string errors;
+    return m_reader->parse(begin, end, &value, &errors);
+}
+
+void StreamingCardReader::ThrowParseError() const
+{
+    // The scan accepts only text the DOM reader accepts, so this should not happen. If it does, let the DOM reader
+    // produce the error so that it matches the non-streaming path.
+    ParseUtil::GetJsonValueFromString(std::string(m_begin, m_end));
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object");
+}
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseCardElement.h"
+#include "ParseContext.h"
+
+namespace AdaptiveCards
+{
+// Reads an Adaptive Card directly from its JSON text without building a DOM for the whole card.
+//
+// The reader makes a single validating pass over the text. Card level properties are small and are read into a
+// Json::Value, but each element of "body" is only recorded as a slice of the input. DeserializeBody then builds a
+// Json::Value for one element at a time, hands it to the registered element parser and releases it before moving on,
+// so at no point do the DOM and the object model for the whole body exist side by side. Unknown and custom elements
+// go through the same per-element path, so their parsers still see a regular Json::Value for their own subtree.
+//
+// The input must outlive the reader.
+class StreamingCardReader
+{
+public:
+    StreamingCardReader(const char* begin, const char* end);
+
+    // Scans the card. Returns false if the text is not a well formed JSON object, in which case callers should use
+    // the DOM based path so that errors are reported exactly as they are today.
+    bool Read();
+
+    // Card level properties, excluding the elements of "body"
+    const Json::Value& GetCardProperties() const;
+
+    // Deserializes the body elements recorded by Read
+    std::vector<std::shared_ptr<BaseCardElement>> DeserializeBody(ParseContext& context) const;
+
+private:
+    const char* SkipWhitespace(const char* current) const;
+    const char* SkipString(const char* current) const;
+    const char* SkipNumber(const char* current) const;
+    const char* SkipLiteral(const char* current, const char* literal) const;
+    const char* SkipValue(const char* current, unsigned int depth) const;
+
+    bool ParseSlice(const char* begin, const char* end, Json::Value& value) const;
+    [[noreturn]] void ThrowParseError() const;
+
+    const char* m_begin;
+    const char* m_end;
+    std::unique_ptr<Json::CharReader> m_reader;
+
+    Json::Value m_cardProperties;
+    std::vector<std::pair<const char*, const char*>> m_bodySlices;
+    bool m_hasBodySlices;
+};
+} // namespace AdaptiveCards
@@ -15,14 +15,16 @@ Table::Table() :
 
 void Table::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::FirstRowAsHeaders,
+         AdaptiveCardSchemaKey::GridStyle,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rows,
+         AdaptiveCardSchemaKey::ShowGridLines,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 bool Table::GetShowGridLines() const
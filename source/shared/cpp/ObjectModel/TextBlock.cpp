@@ -202,11 +202,16 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Wrap,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::MaxLines,
+         AdaptiveCardSchemaKey::HorizontalAlignment},
+        [this]() {
+            std::unordered_set<std::string> textElementProperties;
+            m_textElementProperties->PopulateKnownPropertiesSet(textElementProperties);
+            return textElementProperties;
+        }());
+    m_knownProperties = &knownProperties;
 }
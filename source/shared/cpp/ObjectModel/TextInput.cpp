@@ -9,6 +9,7 @@ using namespace AdaptiveCards;
 
 std::unordered_map<std::string, std::string> AdaptiveCards::TextInput::inputIdToLabelMap;
 std::unordered_set<std::string> AdaptiveCards::TextInput::requiredInputIdSet;
+std::mutex AdaptiveCards::TextInput::inputStateMutex;
 
 TextInput::TextInput() :
     BaseInputElement(CardElementType::TextInput), m_isMultiline(false), m_maxLength(0), m_style(TextInputStyle::Text)
@@ -159,6 +160,7 @@ std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& cont
     if (textInput->GetIsRequired())
     {
         // If the ChoiceSetInput is required, add its ID to the set of required inputs
+        std::lock_guard<std::mutex> lock(TextInput::inputStateMutex);
         TextInput::requiredInputIdSet.insert(textInput->GetId());
     }
 
@@ -172,10 +174,12 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::IsMultiline,
+         AdaptiveCardSchemaKey::MaxLength,
+         AdaptiveCardSchemaKey::TextInput});
+    m_knownProperties = &knownProperties;
 }
@@ -5,6 +5,7 @@
 #include "pch.h"
 #include "BaseInputElement.h"
 #include "ElementParserRegistration.h"
+#include <mutex>
 
 namespace AdaptiveCards
 {
@@ -45,12 +46,14 @@ public:
     static void addLabel(const std::string& labelId, const std::string& label)
     {
         if (!labelId.empty() && !label.empty()) {
+            std::lock_guard<std::mutex> lock(inputStateMutex);
             inputIdToLabelMap[labelId] = label;
         }
     }
 
     static std::string getLabel(const std::string& labelId)
     {
+        std::lock_guard<std::mutex> lock(inputStateMutex);
         if (inputIdToLabelMap.find(labelId) != inputIdToLabelMap.end())
         {
             return inputIdToLabelMap[labelId];
@@ -64,9 +67,10 @@ public:
         if (textInput != nullptr && textInput.get() != nullptr) {
             auto input = textInput.get();
             auto labelId = input->GetId();
+            const std::string mappedLabel = getLabel(labelId);
 
-            if (inputIdToLabelMap.find(labelId) != inputIdToLabelMap.end()) {
-                label += " " + inputIdToLabelMap[labelId];
+            if (!mappedLabel.empty()) {
+                label += " " + mappedLabel;
             } else if (!input->GetLabel().empty()) {
                 label += " " + input->GetLabel();
             }
@@ -82,12 +86,15 @@ public:
 
     static bool getIsRequired(const std::string& labelId)
     {
+        std::lock_guard<std::mutex> lock(inputStateMutex);
         return requiredInputIdSet.find(labelId) != requiredInputIdSet.end();
     }
 
 private:
     static std::unordered_map<std::string, std::string> inputIdToLabelMap;
     static std::unordered_set<std::string> requiredInputIdSet;
+    // Cards may be parsed on several threads at once (see ParseThreadPool)
+    static std::mutex inputStateMutex;
     void PopulateKnownPropertiesSet();
 
     std::string m_placeholder;
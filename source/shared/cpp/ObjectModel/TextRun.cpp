@@ -14,7 +14,15 @@ TextRun::TextRun() :
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    static const KnownProperties knownProperties(
+        m_knownProperties,
+        {},
+        [this]() {
+            std::unordered_set<std::string> textElementProperties;
+            m_textElementProperties->PopulateKnownPropertiesSet(textElementProperties);
+            return textElementProperties;
+        }());
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
@@ -163,7 +171,7 @@ void TextRun::SetUnderline(const bool value)
 
 std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
+    std::shared_ptr<TextRun> inlineTextRun = context.MakeShared<TextRun>();
 
     if (json.isString())
     {
@@ -178,7 +186,7 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
         inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
         inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+        inlineTextRun->m_additionalProperties.Capture(json, *inlineTextRun->m_knownProperties, context.GetSourceDocument());
     }
 
     return inlineTextRun;
@@ -50,6 +50,9 @@ std::shared_ptr<ThemedUrl> ThemedUrl::Deserialize(ParseContext&, const Json::Val
 
 void ThemedUrl::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Theme),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const KnownProperties knownProperties(
+        nullptr,
+        {AdaptiveCardSchemaKey::Theme,
+         AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
@@ -7,6 +7,7 @@
 //
 #pragma once
 
+#include "KnownProperties.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 
@@ -43,7 +44,7 @@ namespace AdaptiveCards
     private:
         void PopulateKnownPropertiesSet();
 
-        std::unordered_set<std::string> m_knownProperties;
+        const KnownProperties* m_knownProperties;
         ACTheme m_theme;
         std::string m_url;
     };
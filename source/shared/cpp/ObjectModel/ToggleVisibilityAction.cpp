@@ -53,5 +53,6 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    static const KnownProperties knownProperties(m_knownProperties, {AdaptiveCardSchemaKey::TargetElements});
+    m_knownProperties = &knownProperties;
 }
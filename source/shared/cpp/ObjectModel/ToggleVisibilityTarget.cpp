@@ -42,7 +42,7 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
     {
         toggleVisibilityTargetElement->SetElementId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ElementId, true));
 
-        auto propertyValue = json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), Json::Value());
+        const Json::Value& propertyValue = ParseUtil::GetMember(json, AdaptiveCardSchemaKey::IsVisible);
         if (!propertyValue.empty())
         {
             if (!propertyValue.isBool())
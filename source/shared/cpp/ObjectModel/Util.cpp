@@ -140,11 +140,7 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
     {
         if (action->GetElementType() == ActionType::ShowCard)
         {
-            auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
-            if (showCardAction->GetCard()->GetVersion().empty())
-            {
-                showCardAction->GetCard()->SetVersion(version);
-            }
+            std::static_pointer_cast<ShowCardAction>(action)->SetDefaultCardVersion(version);
         }
     }
 }
@@ -160,3 +156,18 @@ void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<s
         }
     }
 }
+
+void HandleUnknownProperties(const Json::Value& json, const AdaptiveCards::KnownProperties& knownProperties, Json::Value& unknownProperties)
+{
+    for (auto it = json.begin(); it != json.end(); ++it)
+    {
+        // Look the name up in place and only copy it out for the rare property that isn't known
+        const char* nameEnd;
+        const char* name = it.memberName(&nameEnd);
+        const std::string_view key(name, std::find(name, nameEnd, '\0') - name);
+        if (!knownProperties.Contains(key))
+        {
+            unknownProperties[std::string(key)] = *it;
+        }
+    }
+}
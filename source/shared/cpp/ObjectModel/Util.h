@@ -13,3 +13,4 @@ std::optional<int> ParseSizeForPixelSize(
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>>& actions, const std::string& version);
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+void HandleUnknownProperties(const Json::Value& json, const AdaptiveCards::KnownProperties& knownProperties, Json::Value& unknownProperties);